@@ -0,0 +1,39 @@
+/**
+ * @file    Arduino.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   Minimal Arduino API for building the MCP23008 library on Linux
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "Arduino.h"
+
+#include <time.h>
+
+static uint64_t monotonicMicros() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const uint64_t start = monotonicMicros();
+
+unsigned long millis() {
+  return (monotonicMicros() - start) / 1000;
+}
+
+unsigned long micros() {
+  return monotonicMicros() - start;
+}
+
+void delay(unsigned long ms) {
+  struct timespec ts {static_cast<time_t>(ms / 1000), static_cast<long>(ms % 1000) * 1000000};
+  while (nanosleep(&ts, &ts) != 0) {}
+}
+
+void delayMicroseconds(unsigned int us) {
+  struct timespec ts {static_cast<time_t>(us / 1000000), static_cast<long>(us % 1000000) * 1000};
+  while (nanosleep(&ts, &ts) != 0) {}
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    Arduino.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   Minimal Arduino API for building the MCP23008 library on Linux
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define HIGH          0x1
+#define LOW           0x0
+
+#define INPUT         0x0
+#define OUTPUT        0x1
+#define INPUT_PULLUP  0x2
+
+#define CHANGE        1
+#define FALLING       2
+#define RISING        3
+
+/**
+ * @brief milliseconds since start of program
+ *
+ * @return unsigned long milliseconds
+ */
+unsigned long millis();
+
+/**
+ * @brief microseconds since start of program
+ *
+ * @return unsigned long microseconds
+ */
+unsigned long micros();
+
+/**
+ * @brief wait for milliseconds
+ *
+ * @param ms milliseconds
+ */
+void delay(unsigned long ms);
+
+/**
+ * @brief wait for microseconds
+ *
+ * @param us microseconds
+ */
+void delayMicroseconds(unsigned int us);
+
+/* There is no native GPIO on Linux, NativePin operates on these no-op functions. */
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) {return LOW;}
+
+/**
+ * @brief Class Print
+ *
+ * Byte output stream as in Arduino, derive and implement write(uint8_t).
+ */
+class Print {
+  public:
+    virtual ~Print() = default;
+
+    /**
+     * @brief write one byte
+     *
+     * @param value byte to write
+     * @return size_t number of bytes written
+     */
+    virtual size_t write(uint8_t value) = 0;
+
+    /**
+     * @brief write a buffer
+     *
+     * @param buffer bytes to write
+     * @param size number of bytes
+     * @return size_t number of bytes written
+     */
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+      size_t n = 0;
+      while (size--) {
+        if (write(*buffer++) == 0) {
+          break;
+        }
+        ++n;
+      }
+      return n;
+    }
+};
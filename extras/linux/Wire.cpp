@@ -0,0 +1,174 @@
+/**
+ * @file    Wire.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   TwoWire on Linux i2c-dev for the MCP23008 library
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "Wire.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+TwoWire Wire;
+
+static int ioctlTransfer(int fd, struct i2c_rdwr_ioctl_data *data) {
+  return ioctl(fd, I2C_RDWR, data);
+}
+
+TwoWire::TwoWire()
+: _fd{-1}, _ownFd{false}, _transfer{ioctlTransfer}, _address{0},
+  _txBuffer{}, _txLength{0},
+  _writeAddress{}, _writeStart{}, _writeLength{}, _writes{0}, _txStart{0},
+  _rxBuffer{}, _rxLength{0}, _rxIndex{0}, _error{0}, _transfers{0}
+{}
+
+TwoWire::~TwoWire() {
+  end();
+}
+
+bool TwoWire::begin(const char *device) {
+  end();
+  _fd = open(device, O_RDWR | O_CLOEXEC);
+  _ownFd = (_fd >= 0);
+  return _ownFd;
+}
+
+void TwoWire::begin(int fd) {
+  end();
+  _fd = fd;
+}
+
+void TwoWire::end() {
+  if (_ownFd) {
+    close(_fd);
+  }
+  _fd = -1;
+  _ownFd = false;
+}
+
+void TwoWire::setTransfer(Transfer transfer) {
+  _transfer = transfer ? transfer : ioctlTransfer;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  // no room for another message: send the kept writes on their own,
+  // an error is reported by the following endTransmission()
+  if ((_writes >= MAX_WRITES) && (transfer(0) < 0)) {
+    _error = status();
+  }
+  _address = address;
+  _txStart = _txLength;
+}
+
+size_t TwoWire::write(uint8_t value) {
+  if (_txLength >= BUFFER_SIZE) {
+    return 0;
+  }
+  _txBuffer[_txLength++] = value;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while ((n < size) && write(buffer[n])) {
+    ++n;
+  }
+  return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  if (_error) {
+    // the kept writes failed, drop this message too
+    uint8_t error = _error;
+    discard();
+    return error;
+  }
+  _writeAddress[_writes] = _address;
+  _writeStart[_writes] = _txStart;
+  _writeLength[_writes] = _txLength - _txStart;
+  ++_writes;
+  if (!sendStop) {
+    // sent together with the next transmission or requestFrom()
+    return 0;
+  }
+  if (transfer(0) < 0) {
+    return status();
+  }
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t) {
+  _rxLength = 0;
+  _rxIndex = 0;
+  if (quantity > BUFFER_SIZE) {
+    quantity = BUFFER_SIZE;
+  }
+  if (_error) {
+    discard();
+    return 0;
+  }
+  if ((_writes >= MAX_WRITES) && (transfer(0) < 0)) {
+    return 0;
+  }
+  _address = address;
+  if ((quantity == 0) || (transfer(quantity) < 0)) {
+    return 0;
+  }
+  _rxLength = quantity;
+  return quantity;
+}
+
+int TwoWire::read() {
+  if (_rxIndex >= _rxLength) {
+    return -1;
+  }
+  return _rxBuffer[_rxIndex++];
+}
+
+void TwoWire::discard() {
+  _writes = 0;
+  _txLength = 0;
+  _txStart = 0;
+  _error = 0;
+}
+
+uint8_t TwoWire::status() const {
+  return ((errno == ENXIO) || (errno == EREMOTEIO)) ? 2 : 4;
+}
+
+int TwoWire::transfer(uint8_t readLength) {
+  struct i2c_msg messages[MAX_WRITES + 1];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < _writes; ++i) {
+    messages[n].addr = _writeAddress[i];
+    messages[n].flags = 0;
+    messages[n].len = _writeLength[i];
+    messages[n].buf = _txBuffer + _writeStart[i];
+    ++n;
+  }
+  if (readLength) {
+    messages[n].addr = _address;
+    messages[n].flags = I2C_M_RD;
+    messages[n].len = readLength;
+    messages[n].buf = _rxBuffer;
+    ++n;
+  }
+  discard();
+  if (n == 0) {
+    return 0;
+  }
+
+  struct i2c_rdwr_ioctl_data data;
+  data.msgs = messages;
+  data.nmsgs = n;
+  ++_transfers;
+  return _transfer(_fd, &data);
+}
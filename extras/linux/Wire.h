@@ -0,0 +1,176 @@
+/**
+ * @file    Wire.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   TwoWire on Linux i2c-dev for the MCP23008 library
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+struct i2c_rdwr_ioctl_data;
+
+/**
+ * @brief Class TwoWire
+ *
+ * Implements the part of the Arduino TwoWire API used by the MCP23008
+ * library on top of the Linux i2c-dev interface. Every bus transaction
+ * is one I2C_RDWR ioctl:
+ *
+ * endTransmission() sends the buffered bytes as one write message.
+ *
+ * endTransmission(false) keeps the bytes, following transmissions and
+ * the next requestFrom() are sent together with them (repeated start),
+ * so a register read or a write with read back costs one system call.
+ *
+ * The file descriptor can be injected with begin(int) and the ioctl
+ * can be replaced with setTransfer(), e.g. to test against a fake device.
+ */
+class TwoWire {
+  public:
+    /**
+     * @brief function which executes one combined transfer
+     *
+     * Returns the number of executed messages or -1 on error,
+     * same as ioctl(fd, I2C_RDWR, data).
+     */
+    using Transfer = int (*)(int fd, struct i2c_rdwr_ioctl_data *data);
+
+    /**
+     * @brief Construct a new TwoWire object
+     *
+     */
+    TwoWire();
+
+    /**
+     * @brief Destroy the TwoWire object and close an owned file descriptor
+     *
+     */
+    ~TwoWire();
+
+    /**
+     * @brief open i2c-dev device
+     *
+     * @param device path of device; default = "/dev/i2c-1";
+     * @return true device opened
+     * @return false error
+     */
+    bool begin(const char *device = "/dev/i2c-1");
+
+    /**
+     * @brief use an already opened file descriptor (not closed by TwoWire)
+     *
+     * @param fd file descriptor
+     */
+    void begin(int fd);
+
+    /**
+     * @brief close an owned file descriptor
+     *
+     */
+    void end();
+
+    /**
+     * @brief replace the transfer function
+     *
+     * @param transfer transfer function; nullptr = ioctl(I2C_RDWR);
+     */
+    void setTransfer(Transfer transfer);
+
+    /**
+     * @brief the bus clock is a property of the adapter on Linux, no effect
+     *
+     */
+    void setClock(uint32_t) {}
+
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t value);
+    size_t write(const uint8_t *buffer, size_t size);
+
+    /**
+     * @brief send buffered bytes
+     *
+     * @param sendStop false = keep the bytes for a repeated start read
+     * @return uint8_t status as Arduino: 0 = OK, 1 = data too long, 2 = NACK, 4 = other error
+     */
+    uint8_t endTransmission(bool sendStop = true);
+
+    /**
+     * @brief read bytes from device, combined with pending write bytes
+     *
+     * @param address I2C address
+     * @param quantity number of bytes
+     * @param sendStop ignored, the read always ends the transaction
+     * @return uint8_t number of bytes read
+     */
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop = 1);
+
+    int available() const {return _rxLength - _rxIndex;}
+    int read();
+
+    /**
+     * @brief Get the number of transfers (system calls) since start
+     *
+     * @return uint32_t number of transfers
+     */
+    uint32_t transfers() const {return _transfers;}
+
+  private:
+    /**
+     * @brief size of transmit and receive buffers
+     *
+     */
+    static constexpr uint8_t BUFFER_SIZE {32};
+
+    /**
+     * @brief maximum number of write messages in one transfer
+     *
+     */
+    static constexpr uint8_t MAX_WRITES {3};
+
+    /**
+     * @brief execute one I2C_RDWR transfer of the pending writes and an optional read
+     *
+     * @param readLength number of bytes to read; 0 = write only
+     * @return int number of executed messages or -1 on error
+     */
+    int transfer(uint8_t readLength);
+
+    /**
+     * @brief drop all buffered write messages and a pending error
+     *
+     */
+    void discard();
+
+    /**
+     * @brief Arduino status of a failed transfer from errno
+     *
+     * @return uint8_t 2 = NACK, 4 = other error
+     */
+    uint8_t status() const;
+
+    int _fd;
+    bool _ownFd;
+    Transfer _transfer;
+    uint8_t _address;
+    uint8_t _txBuffer[BUFFER_SIZE];
+    uint8_t _txLength;
+    /* write messages kept for a repeated start: address, start and length in _txBuffer */
+    uint8_t _writeAddress[MAX_WRITES];
+    uint8_t _writeStart[MAX_WRITES];
+    uint8_t _writeLength[MAX_WRITES];
+    uint8_t _writes;
+    uint8_t _txStart;
+    uint8_t _rxBuffer[BUFFER_SIZE];
+    uint8_t _rxLength;
+    uint8_t _rxIndex;
+    /* status of failed kept writes, returned by the next endTransmission() */
+    uint8_t _error;
+    uint32_t _transfers;
+};
+
+extern TwoWire Wire;
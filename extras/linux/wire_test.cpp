@@ -0,0 +1,224 @@
+/**
+ * @file    wire_test.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   Host test of the Linux TwoWire against a fake MCP23008
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ * Replaces the I2C_RDWR ioctl with setTransfer() and checks that every
+ * register operation is one transfer with the expected message layout.
+ * Run with: make test
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "MCP23008-I2C.h"
+
+using namespace MCP23008_I2C;
+
+namespace {
+
+  constexpr int FAKE_FD {42};
+  constexpr uint8_t ADDRESS {0x20};
+  constexpr uint8_t REGISTERS {11};
+  constexpr uint8_t IODIR {0x00};
+  constexpr uint8_t INTF {0x07};
+  constexpr uint8_t GPIO {0x09};
+  constexpr uint8_t OLAT {0x0A};
+
+  /**
+   * @brief fake MCP23008 with sequential operation
+   *
+   */
+  struct FakeDevice {
+    uint8_t regs[REGISTERS];
+    uint8_t pointer;
+    /* pins which do not follow their latch, e.g. shorted */
+    uint8_t stuck;
+    /* errno of the next transfer; 0 = transfer succeeds */
+    int fail;
+  } fake;
+
+  /**
+   * @brief layout of the last transfer
+   *
+   */
+  struct Layout {
+    int fd;
+    uint32_t messages;
+    uint16_t flags[I2C_RDWR_IOCTL_MAX_MSGS];
+    uint16_t length[I2C_RDWR_IOCTL_MAX_MSGS];
+    uint8_t first[I2C_RDWR_IOCTL_MAX_MSGS];
+  } last;
+
+  int failures {0};
+
+  void check(bool condition, const char *text, int line) {
+    if (!condition) {
+      printf("FAIL line %d: %s\n", line, text);
+      ++failures;
+    }
+  }
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+  void next() {
+    fake.pointer = (fake.pointer + 1) % REGISTERS;
+  }
+
+  void writeRegister(uint8_t value) {
+    fake.regs[fake.pointer] = value;
+    if ((fake.pointer == OLAT) || (fake.pointer == GPIO)) {
+      fake.regs[OLAT] = value;
+      uint8_t outputs = ~fake.regs[IODIR] & ~fake.stuck;
+      fake.regs[GPIO] = (fake.regs[GPIO] & ~outputs) | (value & outputs);
+    }
+    next();
+  }
+
+  int fakeTransfer(int fd, struct i2c_rdwr_ioctl_data *data) {
+    last.fd = fd;
+    last.messages = data->nmsgs;
+    for (uint32_t i = 0; i < data->nmsgs; ++i) {
+      const struct i2c_msg &msg = data->msgs[i];
+      last.flags[i] = msg.flags;
+      last.length[i] = msg.len;
+      last.first[i] = msg.len ? msg.buf[0] : 0;
+    }
+    if (fake.fail) {
+      errno = fake.fail;
+      fake.fail = 0;
+      return -1;
+    }
+    for (uint32_t i = 0; i < data->nmsgs; ++i) {
+      const struct i2c_msg &msg = data->msgs[i];
+      if (msg.addr != ADDRESS) {
+        errno = ENXIO;
+        return -1;
+      }
+      for (uint16_t n = 0; n < msg.len; ++n) {
+        if (msg.flags & I2C_M_RD) {
+          msg.buf[n] = fake.regs[fake.pointer];
+          next();
+        }
+        else if (n == 0) {
+          fake.pointer = msg.buf[0] % REGISTERS;
+        }
+        else {
+          writeRegister(msg.buf[n]);
+        }
+      }
+    }
+    return data->nmsgs;
+  }
+
+  void testRegisterRead(const MCP23008 &mcp) {
+    fake.regs[IODIR] = 0xA5;
+    uint32_t transfers = Wire.transfers();
+    CHECK(mcp.getPinMode8() == 0xA5);
+    CHECK(Wire.transfers() == transfers + 1);
+    CHECK(last.fd == FAKE_FD);
+    CHECK(last.messages == 2);
+    CHECK((last.flags[0] == 0) && (last.length[0] == 1) && (last.first[0] == IODIR));
+    CHECK((last.flags[1] == I2C_M_RD) && (last.length[1] == 1));
+  }
+
+  void testRegisterWrite(const MCP23008 &mcp) {
+    fake.regs[IODIR] = 0x00;
+    uint32_t transfers = Wire.transfers();
+    CHECK(mcp.write8(0x3C) == MCP23008_STATE_OK);
+    CHECK(Wire.transfers() == transfers + 1);
+    CHECK(last.messages == 1);
+    CHECK((last.flags[0] == 0) && (last.length[0] == 2) && (last.first[0] == OLAT));
+    CHECK(fake.regs[OLAT] == 0x3C);
+  }
+
+  void testBurst(const MCP23008 &mcp) {
+    fake.regs[INTF] = 0x01;
+    fake.regs[INTF + 1] = 0x02;
+    fake.regs[GPIO] = 0x03;
+    uint8_t regs[3] {};
+    uint32_t transfers = Wire.transfers();
+    CHECK(mcp.readBurst(INTF, regs, sizeof(regs)) == MCP23008_STATE_OK);
+    CHECK(Wire.transfers() == transfers + 1);
+    CHECK(last.messages == 2);
+    CHECK((last.flags[0] == 0) && (last.length[0] == 1) && (last.first[0] == INTF));
+    CHECK((last.flags[1] == I2C_M_RD) && (last.length[1] == sizeof(regs)));
+    CHECK((regs[0] == 0x01) && (regs[1] == 0x02) && (regs[2] == 0x03));
+  }
+
+  void testVerifiedWrite(const MCP23008 &mcp) {
+    fake.regs[IODIR] = 0x00;
+    fake.stuck = 0x00;
+    OutputCheck result;
+    uint32_t transfers = Wire.transfers();
+    CHECK(mcp.writeVerified8(0x5A, result) == MCP23008_STATE_OK);
+    CHECK(Wire.transfers() == transfers + 1);
+    // write OLAT, write GPIO address, read GPIO...IPOL
+    CHECK(last.messages == 3);
+    CHECK((last.flags[0] == 0) && (last.length[0] == 2) && (last.first[0] == OLAT));
+    CHECK((last.flags[1] == 0) && (last.length[1] == 1) && (last.first[1] == GPIO));
+    CHECK((last.flags[2] == I2C_M_RD) && (last.length[2] == 4));
+    CHECK((result.latchErrors == 0) && (result.pinFaults == 0) && (result.attempts == 1));
+
+    fake.stuck = 0x02;
+    fake.regs[GPIO] = 0x00;
+    CHECK(mcp.writeVerified8(0x0F, result) == MCP23008_ERROR_VERIFY);
+    CHECK(result.pinFaults == 0x02);
+  }
+
+  void testKeptWriteError() {
+    // three kept writes fill the transfer, the fourth transmission flushes them
+    for (uint8_t i = 0; i < 3; ++i) {
+      Wire.beginTransmission(ADDRESS);
+      Wire.write(OLAT);
+      Wire.write(i);
+      CHECK(Wire.endTransmission(false) == 0);
+    }
+    fake.fail = EREMOTEIO;
+    uint32_t transfers = Wire.transfers();
+    Wire.beginTransmission(ADDRESS);
+    CHECK(Wire.transfers() == transfers + 1);
+    CHECK(last.messages == 3);
+    Wire.write(OLAT);
+    Wire.write(0xFF);
+    CHECK(Wire.endTransmission() == 2);
+    // the failed messages are dropped, the bus works again
+    CHECK(Wire.transfers() == transfers + 1);
+    Wire.beginTransmission(ADDRESS);
+    Wire.write(OLAT);
+    Wire.write(0x81);
+    CHECK(Wire.endTransmission() == 0);
+    CHECK(fake.regs[OLAT] == 0x81);
+  }
+
+  void testReadError(const MCP23008 &mcp) {
+    fake.fail = EREMOTEIO;
+    CHECK(mcp.getPinMode8() == MCP23008_ERROR_I2C);
+    CHECK(mcp.getPinMode8() >= 0);
+  }
+}
+
+int main() {
+  Wire.begin(FAKE_FD);
+  Wire.setTransfer(fakeTransfer);
+  MCP23008 mcp{ADDRESS};
+
+  testRegisterRead(mcp);
+  testRegisterWrite(mcp);
+  testBurst(mcp);
+  testVerifiedWrite(mcp);
+  testKeptWriteError();
+  testReadError(mcp);
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""
+Decode, replay and analyze binary traces of the MCP23008-I2C TraceRecorder.
+
+The trace is the byte stream written by TraceRecorder::writeTo(), e.g. captured
+from the serial port into a file. The records are replayed against a simulated
+MCP23008 to detect lost writes, unexpected register changes and output pins
+which do not follow their latch. Bus time is estimated from the transaction
+model of the library (single write = 29 bit, single read = 39 bit, each further
+byte of a sequential transfer = 9 bit, failed access = 11 bit).
+
+usage: mcp23008_trace.py trace.bin [--clock HZ] [--window US] [--list] [--por]
+"""
+
+import argparse
+import struct
+import sys
+from collections import defaultdict
+
+REGISTERS = ["IODIR", "IPOL", "GPINTEN", "DEFVAL", "INTCON", "IOCON",
+             "GPPU", "INTF", "INTCAP", "GPIO", "OLAT"]
+IODIR, IPOL, GPINTEN, DEFVAL, INTCON, IOCON, GPPU, INTF, INTCAP, GPIO, OLAT = range(11)
+
+# register state after power-on reset
+POR_DEFAULTS = [0xFF, 0, 0, 0, 0, 0, 0, 0, 0, None, 0]
+
+FLAG_READ = 0x10
+FLAG_ERROR = 0x20
+FLAG_ADDRESS = 0x40
+FLAG_BURST = 0x80
+
+BITS_WRITE = 29
+BITS_READ = 39
+BITS_BURST = 9
+BITS_ERROR = 11
+
+
+def register_name(reg):
+    return REGISTERS[reg] if reg < len(REGISTERS) else "0x%02X" % reg
+
+
+def decode(data):
+    """Return the list of records (time, address, register, read, error, burst, value)."""
+    if len(data) < 10 or data[0:2] != b"MT":
+        raise ValueError("no MCP23008 trace header")
+    version, address, time, length = struct.unpack_from("<BBIH", data, 2)
+    if version != 1:
+        raise ValueError("unsupported trace version %d" % version)
+    body = data[10:10 + length]
+    if len(body) < length:
+        raise ValueError("trace truncated: %d of %d bytes" % (len(body), length))
+
+    records = []
+    i = 0
+    while i < len(body):
+        header = body[i]
+        i += 1
+        if header & FLAG_ADDRESS:
+            address = body[i]
+            i += 1
+        delta = 0
+        shift = 0
+        while True:
+            byte = body[i]
+            i += 1
+            delta |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        value = body[i]
+        i += 1
+        time = (time + delta) & 0xFFFFFFFF
+        records.append((time, address, header & 0x0F, bool(header & FLAG_READ),
+                        bool(header & FLAG_ERROR), bool(header & FLAG_BURST), value))
+    return records
+
+
+def bus_bits(record):
+    _, _, _, read, error, burst, _ = record
+    if error:
+        return BITS_ERROR
+    if burst:
+        return BITS_BURST
+    return BITS_READ if read else BITS_WRITE
+
+
+class SimulatedMCP23008:
+    """Register model of one MCP23008, unknown registers are learned from reads."""
+
+    def __init__(self, por):
+        self.regs = list(POR_DEFAULTS) if por else [None] * 11
+        self.findings = []
+        self.redundant_reads = 0
+        self.redundant_writes = 0
+
+    def write(self, time, reg, value):
+        if reg == GPIO:
+            reg = OLAT
+        if reg in (INTF, INTCAP) or reg > OLAT:
+            self.findings.append((time, "write to read-only register %s" % register_name(reg)))
+            return
+        if self.regs[reg] == value:
+            self.redundant_writes += 1
+        self.regs[reg] = value
+
+    def read(self, time, reg, value):
+        if reg > OLAT:
+            self.findings.append((time, "read of unknown register 0x%02X" % reg))
+            return
+        if reg == GPIO:
+            self.check_outputs(time, value)
+            return
+        if reg in (INTF, INTCAP):
+            return
+        known = self.regs[reg]
+        if known is not None:
+            if known == value:
+                self.redundant_reads += 1
+            else:
+                self.findings.append((time, "%s read 0x%02X, expected 0x%02X (lost write or reset)"
+                                      % (register_name(reg), value, known)))
+        self.regs[reg] = value
+
+    def check_outputs(self, time, value):
+        iodir, ipol, olat = self.regs[IODIR], self.regs[IPOL], self.regs[OLAT]
+        if iodir is None or ipol is None or olat is None:
+            return
+        faults = (value ^ olat ^ ipol) & ~iodir & 0xFF
+        if faults:
+            self.findings.append((time, "GPIO 0x%02X differs from OLAT 0x%02X on outputs 0x%02X"
+                                  % (value, olat, faults)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("trace", help="binary trace file")
+    parser.add_argument("--clock", type=int, default=100000, help="I2C clock in Hz (default 100000)")
+    parser.add_argument("--window", type=int, default=10000, help="hot spot window in us (default 10000)")
+    parser.add_argument("--top", type=int, default=5, help="number of hot spots to show (default 5)")
+    parser.add_argument("--list", action="store_true", help="list all decoded records")
+    parser.add_argument("--por", action="store_true", help="assume devices start with power-on defaults")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as f:
+        records = decode(f.read())
+    if not records:
+        print("trace is empty")
+        return 0
+
+    bit_us = 1e6 / args.clock
+    devices = {}
+    per_register = defaultdict(lambda: [0, 0, 0, 0.0])
+    windows = defaultdict(float)
+    start = records[0][0]
+    total_us = 0.0
+
+    for record in records:
+        time, address, reg, read, error, burst, value = record
+        elapsed = (time - start) & 0xFFFFFFFF
+        us = bus_bits(record) * bit_us
+        total_us += us
+        windows[elapsed // args.window] += us
+        stats = per_register[(address, reg)]
+        stats[1 if read else 0] += 1
+        stats[3] += us
+        if args.list:
+            print("%10d us  0x%02X  %-7s %-5s 0x%02X%s%s" % (
+                elapsed, address, register_name(reg), "read" if read else "write", value,
+                "  burst" if burst else "", "  ERROR" if error else ""))
+        if error:
+            stats[2] += 1
+            continue
+        device = devices.setdefault(address, SimulatedMCP23008(args.por))
+        if read:
+            device.read(elapsed, reg, value)
+        else:
+            device.write(elapsed, reg, value)
+
+    duration = max((records[-1][0] - start) & 0xFFFFFFFF, 1)
+    print("records: %d  duration: %d us  bus time: %.0f us (%.1f %%) at %d Hz"
+          % (len(records), duration, total_us, 100.0 * total_us / duration, args.clock))
+
+    print("\nper register:")
+    print("  addr  register  writes   reads  errors   bus time     share")
+    for (address, reg), (writes, reads, errors, us) in sorted(
+            per_register.items(), key=lambda item: -item[1][3]):
+        print("  0x%02X  %-8s %7d %7d %7d %8.0f us %7.1f %%"
+              % (address, register_name(reg), writes, reads, errors, us, 100.0 * us / total_us))
+
+    print("\nhot spots (%d us windows):" % args.window)
+    for window, us in sorted(windows.items(), key=lambda item: -item[1])[:args.top]:
+        print("  %10d us  bus time %8.0f us  load %5.1f %%"
+              % (window * args.window, us, 100.0 * us / args.window))
+
+    print("\nreplay:")
+    for address, device in sorted(devices.items()):
+        print("  0x%02X  redundant reads: %d  redundant writes: %d"
+              % (address, device.redundant_reads, device.redundant_writes))
+        for time, text in device.findings:
+            print("        %10d us  %s" % (time, text))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
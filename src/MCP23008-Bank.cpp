@@ -0,0 +1,38 @@
+/**
+ * @file    MCP23008-Bank.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Bank Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-Bank.h"
+
+using namespace MCP23008_I2C;
+
+int8_t Bank::begin(bool inputPullUp) const {
+  int8_t state = MCP23008_STATE_OK;
+  for (uint8_t i = 0; i < _count; ++i) {
+    int8_t result = _devices[i]->begin(inputPullUp);
+    if ((result < 0) && (state == MCP23008_STATE_OK)) {
+      state = result;
+    }
+  }
+  return state;
+}
+
+void Bank::setOutputCache(bool enable) const {
+  for (uint8_t i = 0; i < _count; ++i) {
+    _devices[i]->setOutputCache(enable);
+  }
+}
+
+ExpanderPin Bank::pin(uint8_t pin) const {
+  uint8_t index = pin >> 3;
+  if (index >= _count) {
+    return ExpanderPin{nullptr, 0xFF};
+  }
+  return ExpanderPin{_devices[index], static_cast<uint8_t>(pin & 0x07)};
+}
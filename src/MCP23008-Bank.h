@@ -0,0 +1,92 @@
+/**
+ * @file    MCP23008-Bank.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Bank Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_BANK_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief Class Bank
+   *
+   * Groups several MCP23008 devices to one continuous pin range:
+   * pin 0...7 belongs to the first device, pin 8...15 to the second one
+   * and so on. The bank keeps a pointer to the array of devices, the
+   * array has to stay valid as long as the bank is used.
+   */
+  class Bank {
+    public:
+      /**
+       * @brief Construct a new Bank object
+       *
+       * @param devices array of pointers of devices
+       * @param count number of devices
+       */
+      Bank(MCP23008 *const devices[], uint8_t count)
+      : _devices{devices}, _count{count} {}
+
+      /**
+       * @brief init all devices of bank
+       *
+       * @param inputPullUp optional force all inputs with Pull-up; default = true;
+       * @return int8_t status of begin
+       *
+       * @retval  0: state OK
+       * @retval <0: error code of the first failing device
+       */
+      int8_t begin(bool inputPullUp = true) const;
+
+      /**
+       * @brief enable or disable the OLAT cache of all devices
+       *
+       * @param enable true or false
+       */
+      void setOutputCache(bool enable) const;
+
+      /**
+       * @brief Get a pin handle for a pin of bank
+       *
+       * @param pin pin number of pin 0...(8 * count - 1)
+       * @return ExpanderPin pin handle; invalid if pin is out of range
+       */
+      ExpanderPin pin(uint8_t pin) const;
+
+      /**
+       * @brief Get a device of bank
+       *
+       * @param index index of device
+       * @return MCP23008* pointer to device; nullptr if index is out of range
+       */
+      MCP23008* device(uint8_t index) const {return index < _count ? _devices[index] : nullptr;}
+
+      /**
+       * @brief Get the number of devices
+       *
+       * @return uint8_t number of devices
+       */
+      uint8_t count() const {return _count;}
+
+    private:
+      /**
+       * @brief array of pointers of devices
+       *
+       */
+      MCP23008 *const *_devices;
+
+      /**
+       * @brief number of devices
+       *
+       */
+      uint8_t _count;
+  };
+}
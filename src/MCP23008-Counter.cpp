@@ -0,0 +1,178 @@
+/**
+ * @file    MCP23008-Counter.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Pulse Counter Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-Counter.h"
+#include "MCP23008-Constants.h"
+
+using namespace MCP23008_I2C;
+using namespace MCP23008_Constants;
+
+PulseCounter::PulseCounter(MCP23008 *device)
+: _device{device}, _count{}, _windowCount{}, _frequency{},
+  _windowStart{0}, _window{1000}, _pinMask{0}, _rising{0}, _falling{0},
+  _state{0}, _pending{false}
+{}
+
+int PulseCounter::begin(uint8_t pinMask, uint8_t mode) {
+  if (_device == nullptr) {
+    return MCP23008_ERROR_VALUE;
+  }
+  if ((mode != RISING) && (mode != FALLING) && (mode != CHANGE)) {
+    return MCP23008_ERROR_VALUE;
+  }
+  _pinMask = pinMask;
+  _rising = ((mode == RISING) || (mode == CHANGE)) ? pinMask : 0;
+  _falling = ((mode == FALLING) || (mode == CHANGE)) ? pinMask : 0;
+
+  // counter pins: input, compare against previous value, interrupt enabled
+  int reg = _device->getPinMode8();
+  if (reg < 0) {
+    return reg;
+  }
+  int state = _device->setPinMode8(reg | pinMask);
+  if (state < 0) {
+    return state;
+  }
+  if ((reg = _device->getInterruptControl8()) < 0) {
+    return reg;
+  }
+  if ((state = _device->setInterruptControl8(reg & ~pinMask)) < 0) {
+    return state;
+  }
+  if ((reg = _device->getInterruptEnable8()) < 0) {
+    return reg;
+  }
+  if ((state = _device->setInterruptEnable8(reg | pinMask)) < 0) {
+    return state;
+  }
+
+  // clear pending interrupt and take the current state as start
+  uint8_t regs[3];
+  _pending = false;
+  if ((state = _device->readBurst(MCP23008_INTF_REG, regs, sizeof(regs))) < 0) {
+    return state;
+  }
+  _state = regs[2];
+  for (uint8_t i = 0; i < 8; ++i) {
+    _count[i] = 0;
+    _windowCount[i] = 0;
+    _frequency[i] = 0.0f;
+  }
+  _windowStart = millis();
+  return MCP23008_STATE_OK;
+}
+
+int PulseCounter::end() {
+  if (_device == nullptr) {
+    return MCP23008_ERROR_VALUE;
+  }
+  int reg = _device->getInterruptEnable8();
+  if (reg < 0) {
+    return reg;
+  }
+  return _device->setInterruptEnable8(reg & ~_pinMask);
+}
+
+int8_t PulseCounter::setEdge(uint8_t pin, uint8_t mode) {
+  if (pin > 7) {
+    return MCP23008_ERROR_PIN;
+  }
+  if ((mode != RISING) && (mode != FALLING) && (mode != CHANGE)) {
+    return MCP23008_ERROR_VALUE;
+  }
+  uint8_t mask = 1 << pin;
+  _rising &= ~mask;
+  _falling &= ~mask;
+  if ((mode == RISING) || (mode == CHANGE)) {
+    _rising |= mask;
+  }
+  if ((mode == FALLING) || (mode == CHANGE)) {
+    _falling |= mask;
+  }
+  return MCP23008_STATE_OK;
+}
+
+void PulseCounter::resetCount(uint8_t pin) {
+  if (pin > 7) {
+    return;
+  }
+  _count[pin] = 0;
+  _windowCount[pin] = 0;
+}
+
+int PulseCounter::update() {
+  int state = 0;
+  if (_pending) {
+    state = service();
+    if (state == MCP23008_STATE_OK) {
+      state = 1;
+    }
+  }
+  updateWindow();
+  return state;
+}
+
+int PulseCounter::poll() {
+  int state = service();
+  updateWindow();
+  return state;
+}
+
+int PulseCounter::service() {
+  if (_device == nullptr) {
+    return MCP23008_ERROR_VALUE;
+  }
+  // an interrupt during the transfer marks the next service
+  _pending = false;
+  uint8_t regs[3];
+  int8_t state = _device->readBurst(MCP23008_INTF_REG, regs, sizeof(regs));
+  if (state < 0) {
+    // INT stays asserted without a further edge, retry with the next update()
+    _pending = true;
+    return state;
+  }
+  uint8_t intf = regs[0];
+  uint8_t intcap = regs[1];
+  uint8_t gpio = regs[2];
+  if (intf & _pinMask) {
+    // port state at interrupt time, further edges until the read follow
+    countEdges(_state, intcap);
+    countEdges(intcap, gpio);
+  }
+  else {
+    countEdges(_state, gpio);
+  }
+  _state = gpio;
+  return MCP23008_STATE_OK;
+}
+
+void PulseCounter::countEdges(uint8_t from, uint8_t to) {
+  uint8_t edges = ((~from & to & _rising) | (from & ~to & _falling)) & _pinMask;
+  for (uint8_t pin = 0; edges; ++pin, edges >>= 1) {
+    if (edges & 0x01) {
+      ++_count[pin];
+    }
+  }
+}
+
+void PulseCounter::updateWindow() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - _windowStart;
+  if (elapsed < _window) {
+    return;
+  }
+  for (uint8_t pin = 0; pin < 8; ++pin) {
+    // a pin counting both edges sees two edges per pulse
+    uint8_t edges = ((_rising & _falling) & (1 << pin)) ? 2 : 1;
+    _frequency[pin] = (_count[pin] - _windowCount[pin]) * 1000.0f / (static_cast<float>(elapsed) * edges);
+    _windowCount[pin] = _count[pin];
+  }
+  _windowStart = now;
+}
@@ -0,0 +1,230 @@
+/**
+ * @file    MCP23008-Counter.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Pulse Counter Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_COUNTER_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief Class PulseCounter
+   *
+   * Counts edges on the inputs of one MCP23008 via interrupt-on-change.
+   * Every service reads INTF, INTCAP and GPIO in one sequential burst,
+   * this clears the interrupt of the device. Edges are taken from the
+   * transitions last state -> captured state (INTCAP) -> current state
+   * (GPIO), so all 8 channels are handled with one transaction.
+   *
+   * Connect the INT pin of the device to an interrupt pin, call
+   * handleInterrupt() from the interrupt routine and update() from loop().
+   * Without INT line call poll() regularly instead.
+   */
+  class PulseCounter {
+    public:
+      /**
+       * @brief Construct a new PulseCounter object
+       *
+       * @param device pointer to MCP23008 device
+       */
+      explicit PulseCounter(MCP23008 *device);
+
+      /**
+       * @brief configure pins as counter inputs and enable interrupt-on-change
+       *
+       * Sets the pins as inputs (IODIR), compares against the previous
+       * value (INTCON) and enables the interrupts (GPINTEN).
+       * All counters are cleared.
+       *
+       * @param pinMask bit mask of counter pins
+       * @param mode counted edge of all pins (RISING, FALLING, CHANGE); default = RISING;
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int begin(uint8_t pinMask, uint8_t mode = RISING);
+
+      /**
+       * @brief disable interrupt-on-change of counter pins (GPINTEN)
+       *
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int end();
+
+      /**
+       * @brief Set the counted edge of a pin
+       *
+       * @param pin pin number of pin 0...7
+       * @param mode counted edge (RISING, FALLING, CHANGE)
+       * @return int8_t status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t setEdge(uint8_t pin, uint8_t mode);
+
+      /**
+       * @brief Set the window of the frequency measurement
+       *
+       * @param windowMillis window in milliseconds; default = 1000;
+       */
+      void setWindow(uint32_t windowMillis) {_window = windowMillis ? windowMillis : 1;}
+
+      /**
+       * @brief mark interrupt as pending, call from the interrupt routine of the INT pin
+       *
+       */
+      void handleInterrupt() {_pending = true;}
+
+      /**
+       * @brief service a pending interrupt and update the frequency window
+       *
+       * @return int status
+       *
+       * @retval  1: interrupt serviced
+       * @retval  0: nothing to do
+       * @retval <0: error code
+       */
+      int update();
+
+      /**
+       * @brief service the device without interrupt and update the frequency window
+       *
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int poll();
+
+      /**
+       * @brief Get the number of counted edges of a pin
+       *
+       * @param pin pin number of pin 0...7
+       * @return uint32_t number of edges; 0 for invalid pin
+       */
+      uint32_t count(uint8_t pin) const {return pin > 7 ? 0 : _count[pin];}
+
+      /**
+       * @brief clear the counter of a pin
+       *
+       * @param pin pin number of pin 0...7
+       */
+      void resetCount(uint8_t pin);
+
+      /**
+       * @brief Get the pulse frequency of a pin measured in the last complete window
+       *
+       * For a pin counting both edges (CHANGE) the edge rate is halved,
+       * so the result is the pulse frequency in every mode.
+       *
+       * @param pin pin number of pin 0...7
+       * @return float frequency in Hz; 0 for invalid pin
+       */
+      float frequency(uint8_t pin) const {return pin > 7 ? 0.0f : _frequency[pin];}
+
+    private:
+      /**
+       * @brief read INTF, INTCAP and GPIO and count edges
+       *
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int service();
+
+      /**
+       * @brief count edges of the transition from to
+       *
+       * @param from previous port state
+       * @param to next port state
+       */
+      void countEdges(uint8_t from, uint8_t to);
+
+      /**
+       * @brief close the frequency window if it has elapsed
+       *
+       */
+      void updateWindow();
+
+      /**
+       * @brief pointer to MCP23008 device
+       *
+       */
+      MCP23008 *_device;
+
+      /**
+       * @brief edge counters
+       *
+       */
+      uint32_t _count[8];
+
+      /**
+       * @brief counter values at start of window
+       *
+       */
+      uint32_t _windowCount[8];
+
+      /**
+       * @brief frequencies of last window in Hz
+       *
+       */
+      float _frequency[8];
+
+      /**
+       * @brief start of window in milliseconds
+       *
+       */
+      uint32_t _windowStart;
+
+      /**
+       * @brief window in milliseconds
+       *
+       */
+      uint32_t _window;
+
+      /**
+       * @brief bit mask of counter pins
+       *
+       */
+      uint8_t _pinMask;
+
+      /**
+       * @brief pins counting rising edges
+       *
+       */
+      uint8_t _rising;
+
+      /**
+       * @brief pins counting falling edges
+       *
+       */
+      uint8_t _falling;
+
+      /**
+       * @brief last known port state
+       *
+       */
+      uint8_t _state;
+
+      /**
+       * @brief interrupt pending flag, set from interrupt routine
+       *
+       */
+      volatile bool _pending;
+  };
+}
@@ -0,0 +1,153 @@
+/**
+ * @file    MCP23008-Discovery.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Device Discovery Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-Discovery.h"
+#include "MCP23008-Constants.h"
+
+using namespace MCP23008_I2C;
+using namespace MCP23008_Constants;
+
+/**
+ * @brief IOCON bits 7, 6 and 0 are unimplemented and read as 0
+ *
+ */
+static constexpr uint8_t IOCON_UNIMPLEMENTED {0xC1};
+
+/**
+ * @brief read registers without writing the register address first
+ *
+ * @param wire pointer of Wire instance
+ * @param address I2C address
+ * @param buffer buffer for count bytes
+ * @param count number of bytes
+ * @return int8_t status
+ */
+static int8_t readCurrent(TwoWire *wire, uint8_t address, uint8_t *buffer, uint8_t count) {
+  if (wire->requestFrom(address, count) != count) {
+    return MCP23008_ERROR_I2C;
+  }
+  for (uint8_t i = 0; i < count; ++i) {
+    buffer[i] = wire->read();
+  }
+  return MCP23008_STATE_OK;
+}
+
+/**
+ * @brief number of registers which may change between two reads (INTF, INTCAP, GPIO)
+ *
+ */
+static constexpr uint8_t VOLATILE_REGISTERS {3};
+
+/**
+ * @brief check if two rounds of register reads match
+ *
+ * @param first first round of count bytes
+ * @param second second round of count bytes, started offset registers later
+ * @param offset register offset of the second round
+ * @param count number of bytes
+ * @param uniform true if all matching bytes have the same value; may be nullptr
+ * @return true at most VOLATILE_REGISTERS bytes differ
+ */
+static bool roundsMatch(const uint8_t *first, const uint8_t *second, uint8_t offset, uint8_t count,
+                        bool *uniform) {
+  uint8_t matches = 0;
+  bool same = true;
+  int value = -1;
+  for (uint8_t i = 0; i < count; ++i) {
+    uint8_t a = first[(i + offset) % count];
+    if (a == second[i]) {
+      same = same && ((value < 0) || (value == a));
+      value = a;
+      ++matches;
+    }
+  }
+  if (uniform) {
+    *uniform = same;
+  }
+  return (count - matches) <= VOLATILE_REGISTERS;
+}
+
+int8_t MCP23008_I2C::checkDevice(TwoWire *wire, uint8_t address, DeviceHealth &health) {
+  MCP23008 device{address, wire};
+  uint8_t *regs = health.registers;
+  health.address = address;
+  health.flags = 0;
+  health.outputFaults = 0;
+
+  // address only probe
+  if (device.isConnected() < 0) {
+    return health.state = MCP23008_ERROR_I2C;
+  }
+
+  // read two rounds from the current address pointer, nothing is written:
+  // a MCP23008 returns its registers rolling over with a period of 11
+  // bytes, a simple port expander (e.g. PCF8574) returns its pin levels
+  uint8_t current[2 * MCP23008_REGISTER_COUNT];
+  health.state = readCurrent(wire, address, current, sizeof(current));
+  if (health.state < 0) {
+    return health.state;
+  }
+  bool uniform;
+  if (!roundsMatch(current, &current[MCP23008_REGISTER_COUNT], 0, MCP23008_REGISTER_COUNT, &uniform)
+      || uniform) {
+    // no register file seen: a port expander, a MCP23008 with all registers
+    // alike or with sequential operation disabled (SEQOP); do not write
+    return health.state = MCP23008_STATE_UNIDENTIFIED;
+  }
+
+  // likely a MCP23008: read all registers from IODIR
+  health.state = device.readBurst(MCP23008_IODIR_REG, regs, MCP23008_REGISTER_COUNT);
+  if (health.state < 0) {
+    return health.state;
+  }
+  // the registers have to be a rotation of the unaddressed reads
+  bool rotation = false;
+  for (uint8_t offset = 0; (offset < MCP23008_REGISTER_COUNT) && !rotation; ++offset) {
+    rotation = roundsMatch(current, regs, offset, MCP23008_REGISTER_COUNT, nullptr);
+  }
+  if (!rotation) {
+    return health.state = MCP23008_ERROR_VALUE;
+  }
+  if (regs[MCP23008_IOCON_REG] & IOCON_UNIMPLEMENTED) {
+    return health.state = MCP23008_ERROR_VALUE;
+  }
+
+  bool defaults = (regs[MCP23008_IODIR_REG] == 0xFF) && (regs[MCP23008_OLAT_REG] == 0);
+  for (uint8_t i = MCP23008_IPOL_REG; i <= MCP23008_GPPU_REG; ++i) {
+    defaults = defaults && (regs[i] == 0);
+  }
+  if (defaults) {
+    health.flags |= MCP23008_HEALTH_POR_DEFAULTS;
+  }
+  if (regs[MCP23008_INTF_REG]) {
+    health.flags |= MCP23008_HEALTH_INTERRUPT;
+  }
+  health.outputFaults = (regs[MCP23008_GPIO_REG] ^ regs[MCP23008_OLAT_REG] ^ regs[MCP23008_IPOL_REG])
+                        & ~regs[MCP23008_IODIR_REG];
+  if (health.outputFaults) {
+    health.flags |= MCP23008_HEALTH_OUTPUT_FAULT;
+  }
+  return health.state = MCP23008_STATE_OK;
+}
+
+uint32_t MCP23008_I2C::scanDevices(TwoWire *wire, DeviceHealth *health, uint8_t first, uint8_t last) {
+  if ((wire == nullptr) || (last < first) || (last - first > 31) || (last > 0x7F)) {
+    return 0;
+  }
+  uint32_t found = 0;
+  DeviceHealth record;
+  for (uint8_t address = first; address <= last; ++address) {
+    DeviceHealth &target = health ? health[address - first] : record;
+    if (checkDevice(wire, address, target) == MCP23008_STATE_OK) {
+      found |= static_cast<uint32_t>(1) << (address - first);
+    }
+  }
+  return found;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file    MCP23008-Discovery.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Device Discovery Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_DISCOVERY_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief number of registers of MCP23008
+   *
+   */
+  constexpr uint8_t MCP23008_REGISTER_COUNT       {11};
+
+  /**
+   * @brief health flag: registers are at power-on defaults (not configured or reset)
+   *
+   */
+  constexpr uint8_t MCP23008_HEALTH_POR_DEFAULTS  {0x01};
+
+  /**
+   * @brief health flag: an interrupt was pending (cleared by the scan)
+   *
+   */
+  constexpr uint8_t MCP23008_HEALTH_INTERRUPT     {0x02};
+
+  /**
+   * @brief health flag: at least one output pin does not follow its output latch
+   *
+   */
+  constexpr uint8_t MCP23008_HEALTH_OUTPUT_FAULT  {0x04};
+
+  /**
+   * @brief scan state: a device answers but its reads show no register file, nothing was written to it
+   *
+   */
+  constexpr int8_t MCP23008_STATE_UNIDENTIFIED    {2};
+
+  /**
+   * @brief Health record of one scanned address
+   *
+   */
+  struct DeviceHealth {
+    /**
+     * @brief I2C address
+     *
+     */
+    uint8_t address;
+
+    /**
+     * @brief scan state
+     *
+     * MCP23008_STATE_OK: MCP23008 found,
+     * MCP23008_STATE_UNIDENTIFIED: device answers, but can not be identified without a write,
+     * MCP23008_ERROR_I2C: no device or transfer failed,
+     * MCP23008_ERROR_VALUE: device answers but is no MCP23008
+     */
+    int8_t state;
+
+    /**
+     * @brief combination of MCP23008_HEALTH_* flags
+     *
+     */
+    uint8_t flags;
+
+    /**
+     * @brief output pins whose GPIO state differs from OLAT
+     *
+     */
+    uint8_t outputFaults;
+
+    /**
+     * @brief register values IODIR...OLAT
+     *
+     */
+    uint8_t registers[MCP23008_REGISTER_COUNT];
+  };
+
+  /**
+   * @brief scan an address range for MCP23008 devices
+   *
+   * Every address is probed with an address only write. A responding
+   * device is then read twice over all registers without a register
+   * address, nothing is written: a MCP23008 returns its registers rolling
+   * over with a period of 11 bytes, a simple port expander like the
+   * PCF8574 returns its pin levels. Only if this shows a register file, a
+   * register address is sent and all registers are read in one
+   * sequential burst, which has to match the unaddressed reads. A
+   * responder is accepted as MCP23008 if the unimplemented IOCON bits
+   * read as zero.
+   *
+   * A device whose reads show no register file is reported as
+   * MCP23008_STATE_UNIDENTIFIED and not counted as found. This includes
+   * a MCP23008 with all registers alike (e.g. all outputs low) or with
+   * sequential operation disabled (IOCON.SEQOP).
+   *
+   * Note: scan only the MCP23008 address range (0x20...0x27), other
+   * devices may take the register address as data. Reading INTCAP and
+   * GPIO clears pending interrupts of the device.
+   *
+   * @param wire pointer of Wire instance
+   * @param health optional array for health records, one per address of the range; default = nullptr;
+   * @param first first address to scan; default = 0x20;
+   * @param last last address to scan; default = 0x27;
+   * @return uint32_t bit map of found MCP23008 devices, bit 0 = first address; 0 if the range is invalid (more than 32 addresses)
+   */
+  uint32_t scanDevices(TwoWire *wire, DeviceHealth *health = nullptr, uint8_t first = 0x20, uint8_t last = 0x27);
+
+  /**
+   * @brief check one address for a MCP23008 device
+   *
+   * @param wire pointer of Wire instance
+   * @param address I2C address
+   * @param health health record to fill
+   * @return int8_t state of check, same as DeviceHealth::state
+   *
+   * @retval  2: device can not be identified (MCP23008_STATE_UNIDENTIFIED)
+   * @retval  0: MCP23008 found
+   * @retval <0: error code
+   */
+  int8_t checkDevice(TwoWire *wire, uint8_t address, DeviceHealth &health);
+}
@@ -14,8 +14,14 @@
 using namespace MCP23008_I2C;
 using namespace MCP23008_Constants;
 
+/**
+ * @brief status of endTransmission(false) on arduino-esp32 1.0.x (I2C_ERROR_CONTINUE)
+ * 
+ */
+static constexpr uint8_t WIRE_CONTINUE {7};
+
 MCP23008::MCP23008(uint8_t address, TwoWire *wire)
-: _address{address}, _wire{wire}
+: _address{address}, _wire{wire}, _trace{nullptr}, _olat{-1}, _outputCache{false}
 {}
 
 int8_t MCP23008::begin(bool inputPullUp) const {
@@ -38,6 +44,59 @@ int8_t MCP23008::isConnected() const {
   return 1;
 }
 
+int32_t MCP23008::qualifyBusClock(MCP23008 *const devices[], uint8_t count,
+                                  const uint32_t *rates, uint8_t rateCount,
+                                  uint8_t rounds, uint8_t backOff) {
+  if ((devices == nullptr) || (count == 0) || (count > 8) || (rates == nullptr) || (rateCount == 0)) {
+    return MCP23008_ERROR_VALUE;
+  }
+  TwoWire *wire = devices[0]->_wire;
+  for (uint8_t i = 1; i < count; ++i) {
+    if (devices[i]->_wire != wire) {
+      return MCP23008_ERROR_VALUE;
+    }
+  }
+
+  // save DEFVAL of all devices at the slowest rate
+  uint8_t defval[8];
+  wire->setClock(rates[0]);
+  for (uint8_t i = 0; i < count; ++i) {
+    int reg = devices[i]->readReg(MCP23008_DEFVAL_REG);
+    if (reg < 0) {
+      return reg;
+    }
+    defval[i] = reg;
+  }
+
+  // number of rates passed
+  uint8_t passed = 0;
+  for (uint8_t r = 0; r < rateCount; ++r) {
+    int errors = 0;
+    wire->setClock(rates[r]);
+    for (uint8_t i = 0; i < count; ++i) {
+      errors += devices[i]->testPattern(rounds);
+    }
+    // restore DEFVAL at the slowest rate
+    wire->setClock(rates[0]);
+    for (uint8_t i = 0; i < count; ++i) {
+      if (devices[i]->writeReg(MCP23008_DEFVAL_REG, defval[i]) < 0) {
+        return MCP23008_ERROR_I2C;
+      }
+    }
+    if (errors > 0) {
+      break;
+    }
+    ++passed;
+  }
+
+  if (passed == 0) {
+    return MCP23008_ERROR_I2C;
+  }
+  int32_t selected = rates[(passed > backOff) ? passed - 1 - backOff : 0];
+  wire->setClock(selected);
+  return selected;
+}
+
 /* #################################### */
 /* ### --- single pin interface --- ### */
 /* #################################### */
@@ -70,7 +129,7 @@ int MCP23008::write1(uint8_t pin, uint8_t value) const {
   if (pin > 7) {
     return MCP23008_ERROR_PIN;
   }
-  int olat = readReg(MCP23008_OLAT_REG);
+  int olat = readOlat();
   if (olat < 0 ) {
     return olat;
   }
@@ -85,7 +144,7 @@ int MCP23008::write1(uint8_t pin, uint8_t value) const {
   }
   // only write when changed.
   if (pre != olat) {
-    return writeReg(MCP23008_OLAT_REG, olat);
+    return writeOlat(olat);
   }
   return MCP23008_STATE_OK;
 }
@@ -184,7 +243,82 @@ int MCP23008::getPinMode8() const {
 }
 
 int8_t MCP23008::write8(uint8_t value) const {
-  return writeReg(MCP23008_OLAT_REG, value);
+  return writeOlat(value);
+}
+
+int MCP23008::update8(uint8_t mask, uint8_t value) const {
+  int olat = readOlat();
+  if (olat < 0) {
+    return olat;
+  }
+  uint8_t next = (olat & ~mask) | (value & mask);
+  // only write when changed.
+  if (next != olat) {
+    return writeOlat(next);
+  }
+  return MCP23008_STATE_OK;
+}
+
+int MCP23008::toggle8(uint8_t mask) const {
+  int olat = readOlat();
+  if (olat < 0) {
+    return olat;
+  }
+  if (mask == 0) {
+    return MCP23008_STATE_OK;
+  }
+  return writeOlat(olat ^ mask);
+}
+
+int8_t MCP23008::writeVerified8(uint8_t value, OutputCheck &check, uint8_t retries) const {
+  check.latchErrors = 0;
+  check.pinFaults = 0;
+  check.attempts = 0;
+  int8_t state;
+  do {
+    ++check.attempts;
+    // write OLAT without stop, the read back follows with repeated start
+    _wire->beginTransmission(_address);
+    _wire->write(MCP23008_OLAT_REG);
+    _wire->write(value);
+    state = endRepeatedStart();
+    if (_trace) {
+      _trace->record(_address, MCP23008_OLAT_REG, state < 0 ? MCP23008_TRACE_ERROR : 0, value);
+    }
+    // GPIO, OLAT, IODIR, IPOL
+    uint8_t regs[4];
+    if (state == MCP23008_STATE_OK) {
+      state = readBurst(MCP23008_GPIO_REG, regs, sizeof(regs));
+    }
+    if (_outputCache) {
+      _olat = (state < 0) ? -1 : regs[1];
+    }
+    if (state == MCP23008_STATE_OK) {
+      check.latchErrors = regs[1] ^ value;
+      check.pinFaults = (regs[0] ^ regs[1] ^ regs[3]) & ~regs[2];
+    }
+  } while (((state < 0) || check.latchErrors) && (retries-- > 0));
+
+  if (state < 0) {
+    return state;
+  }
+  return (check.latchErrors || check.pinFaults) ? MCP23008_ERROR_VERIFY : MCP23008_STATE_OK;
+}
+
+int MCP23008::writeVerified1(uint8_t pin, uint8_t value, OutputCheck &check, uint8_t retries) const {
+  if (pin > 7) {
+    return MCP23008_ERROR_PIN;
+  }
+  int olat = readOlat();
+  if (olat < 0) {
+    return olat;
+  }
+  uint8_t mask = 1 << pin;
+  int8_t state = writeVerified8(value ? (olat | mask) : (olat & ~mask), check, retries);
+  if (state != MCP23008_ERROR_VERIFY) {
+    return state;
+  }
+  return ((check.latchErrors | check.pinFaults) & mask) ? MCP23008_ERROR_VERIFY : MCP23008_STATE_OK;
 }
 
 int MCP23008::read8() const {
@@ -207,6 +341,32 @@ int MCP23008::getPullup8() const {
   return readReg(MCP23008_GPPU_REG);
 }
 
+int8_t MCP23008::readBurst(uint8_t regAddress, uint8_t *buffer, uint8_t count) const {
+  if ((buffer == nullptr) || (count == 0) || (count > 32)) {
+    return MCP23008_ERROR_VALUE;
+  }
+  int8_t state = MCP23008_STATE_OK;
+  _wire->beginTransmission(_address);
+  _wire->write(regAddress);
+  if ((endRepeatedStart() < 0) || (_wire->requestFrom(_address, count) != count)) {
+    state = MCP23008_ERROR_I2C;
+  }
+  for (uint8_t i = 0; i < count; ++i) {
+    buffer[i] = (state < 0) ? 0 : _wire->read();
+  }
+  if (_trace) {
+    // a failed burst is recorded once
+    uint8_t n = (state < 0) ? 1 : count;
+    uint8_t reg = regAddress;
+    for (uint8_t i = 0; i < n; ++i) {
+      uint8_t flags = MCP23008_TRACE_READ | ((state < 0) ? MCP23008_TRACE_ERROR : 0) | (i ? MCP23008_TRACE_BURST : 0);
+      _trace->record(_address, reg, flags, buffer[i]);
+      reg = (reg < MCP23008_OLAT_REG) ? reg + 1 : MCP23008_IODIR_REG;
+    }
+  }
+  return state;
+}
+
 int MCP23008::setInterrupt(uint8_t pin, uint8_t mode) const {
   int8_t state;
   if (pin > 7) {
@@ -264,6 +424,22 @@ int MCP23008::disableInterrupt(uint8_t pin) const {
   return writeReg(MCP23008_GPINTEN_REG, reg);
 }
 
+int8_t MCP23008::setInterruptEnable8(uint8_t mask) const {
+  return writeReg(MCP23008_GPINTEN_REG, mask);
+}
+
+int MCP23008::getInterruptEnable8() const {
+  return readReg(MCP23008_GPINTEN_REG);
+}
+
+int8_t MCP23008::setInterruptControl8(uint8_t mask) const {
+  return writeReg(MCP23008_INTCON_REG, mask);
+}
+
+int MCP23008::getInterruptControl8() const {
+  return readReg(MCP23008_INTCON_REG);
+}
+
 int MCP23008::readInterruptFlagRegister() const {
   return readReg(MCP23008_INTF_REG);
 }
@@ -313,21 +489,70 @@ int8_t MCP23008::writeReg(uint8_t regAddress, uint8_t value) const {
   _wire->beginTransmission(_address);
   _wire->write(regAddress);
   _wire->write(value);
+  int8_t state = MCP23008_STATE_OK;
   if (_wire->endTransmission() != 0) {
-    return MCP23008_ERROR_I2C;
+    state = MCP23008_ERROR_I2C;
   }
-  return MCP23008_STATE_OK;
+  if (_trace) {
+    _trace->record(_address, regAddress, state < 0 ? MCP23008_TRACE_ERROR : 0, value);
+  }
+  return state;
+}
+
+void MCP23008::setOutputCache(bool enable) {
+  _outputCache = enable;
+  _olat = -1;
+}
+
+int MCP23008::readOlat() const {
+  if (_outputCache && (_olat >= 0)) {
+    return _olat;
+  }
+  int olat = readReg(MCP23008_OLAT_REG);
+  if (_outputCache && (olat >= 0)) {
+    _olat = olat;
+  }
+  return olat;
+}
+
+int8_t MCP23008::writeOlat(uint8_t value) const {
+  int8_t state = writeReg(MCP23008_OLAT_REG, value);
+  if (_outputCache) {
+    // on error the latch state is unknown
+    _olat = (state < 0) ? -1 : value;
+  }
+  return state;
+}
+
+int MCP23008::testPattern(uint8_t rounds) const {
+  static const uint8_t patterns[] {0x55, 0xAA, 0x00, 0xFF, 0x33, 0xCC, 0x0F, 0xF0};
+  int errors = 0;
+  for (uint8_t r = 0; r < rounds; ++r) {
+    uint8_t pattern = patterns[r & 0x07] ^ (r >> 3);
+    if ((writeReg(MCP23008_DEFVAL_REG, pattern) < 0) || (readReg(MCP23008_DEFVAL_REG) != pattern)) {
+      ++errors;
+    }
+  }
+  return errors;
 }
 
 int MCP23008::readReg(uint8_t regAddress) const {
+  int value = MCP23008_ERROR_I2C;
   _wire->beginTransmission(_address);
   _wire->write(regAddress);
-  if (_wire->endTransmission() != 0) {
-    return MCP23008_ERROR_I2C;
+  // repeated start: register address and read form one transaction
+  if ((endRepeatedStart() == MCP23008_STATE_OK) && (_wire->requestFrom(_address, (uint8_t)1) == 1)) {
+    value = _wire->read();
   }
-  uint8_t n = _wire->requestFrom(_address, (uint8_t)1);
-  if (n != 1) {
-    return MCP23008_ERROR_I2C;
+  if (_trace) {
+    _trace->record(_address, regAddress,
+                   value < 0 ? (MCP23008_TRACE_READ | MCP23008_TRACE_ERROR) : MCP23008_TRACE_READ,
+                   value < 0 ? 0 : value);
   }
-  return _wire->read();
+  return value;
+}
+
+int8_t MCP23008::endRepeatedStart() const {
+  uint8_t status = _wire->endTransmission(false);
+  return ((status == 0) || (status == WIRE_CONTINUE)) ? MCP23008_STATE_OK : MCP23008_ERROR_I2C;
 }
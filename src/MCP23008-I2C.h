@@ -14,6 +14,8 @@
 
 #include "Arduino.h"
 #include "Wire.h"
+#include "MCP23008-Trace.h"
+#include "MCP23008-Pin.h"
 
 /**
  * @brief namespace of MCP23008.
@@ -48,6 +50,58 @@ namespace MCP23008_I2C {
    */
   constexpr int8_t MCP23008_ERROR_VALUE        {-3};
 
+  /**
+   * @brief constant which states that a fixed size container has no free entry left
+   * 
+   */
+  constexpr int8_t MCP23008_ERROR_FULL         {-4};
+
+  /**
+   * @brief constant which states that the bus can not serve all jobs in time (BusPlanner)
+   * 
+   */
+  constexpr int8_t MCP23008_ERROR_OVERLOAD     {-5};
+
+  /**
+   * @brief constant which states that the read back of outputs does not match the written value
+   * 
+   */
+  constexpr int8_t MCP23008_ERROR_VERIFY       {-6};
+
+  /**
+   * @brief I2C clock rates in Hz within standard and fast mode of the MCP23008
+   * 
+   * The steps of 100 kHz allow qualifyBusClock() to back off one step as
+   * margin. High-speed mode (1.7 MHz) needs the high-speed master code
+   * which the Wire library does not send, so it is not part of the rates.
+   * 
+   */
+  constexpr uint32_t MCP23008_CLOCK_RATES[]    {100000, 200000, 300000, 400000};
+
+  /**
+   * @brief Result of a verified write of the outputs
+   * 
+   */
+  struct OutputCheck {
+    /**
+     * @brief bits of OLAT which do not hold the written value (latch errors)
+     * 
+     */
+    uint8_t latchErrors;
+
+    /**
+     * @brief output pins whose level (GPIO) differs from their latch (OLAT), e.g. shorted pins
+     * 
+     */
+    uint8_t pinFaults;
+
+    /**
+     * @brief number of write attempts
+     * 
+     */
+    uint8_t attempts;
+  };
+
   /**
    * @brief Class MCP23008
    * 
@@ -92,6 +146,71 @@ namespace MCP23008_I2C {
        */
       uint8_t getAddress() const {return _address;}
 
+      /**
+       * @brief Get the Wire instance of device
+       * 
+       * @return TwoWire* pointer of Wire instance
+       */
+      TwoWire* getWire() const {return _wire;}
+
+      /**
+       * @brief Set a trace recorder for all register accesses
+       * 
+       * @param trace pointer of trace recorder; nullptr = tracing off;
+       */
+      void setTrace(TraceRecorder *trace) {_trace = trace;}
+
+      /**
+       * @brief enable or disable the cache of the Output Latch register (OLAT)
+       * 
+       * With the cache enabled the last written OLAT value is kept in RAM,
+       * so write1(), update8() and toggle8() need no read before the write.
+       * Only enable it if no one else writes the OLAT register of the device.
+       * The cache is invalidated on every call and after a failed write.
+       * 
+       * @param enable true or false
+       */
+      void setOutputCache(bool enable);
+
+      /**
+       * @brief Get a pin handle for a single pin
+       * 
+       * @param pin pin number of pin 0...7
+       * @return ExpanderPin pin handle
+       */
+      ExpanderPin pin(uint8_t pin) {return ExpanderPin{this, pin};}
+
+      /**
+       * @brief qualify the I2C link and select the fastest reliable clock rate
+       * 
+       * Steps through the clock rates in ascending order and runs a
+       * write/read-back pattern test against the Default Compare
+       * register (DEFVAL) of every device. The original DEFVAL values are
+       * read and restored at the first (slowest) rate. Qualification stops
+       * with the first failing rate; of the rates passed with zero errors
+       * the highest one, lowered by backOff steps (but not below the first
+       * rate), is selected and set via setClock(). With the defaults a link
+       * passing 400 kHz runs at 300 kHz. The bus is never run above a given
+       * rate, so the rates must not exceed the rated clock of the devices.
+       * 
+       * All devices must share the same Wire instance.
+       * 
+       * @param devices array of pointers of all devices on the bus
+       * @param count number of devices (1...8)
+       * @param rates clock rates in Hz, ascending; default = MCP23008_CLOCK_RATES;
+       * @param rateCount number of clock rates
+       * @param rounds number of pattern writes per device and rate; default = 16;
+       * @param backOff number of passed rates to step back from the highest one as margin; default = 1;
+       * @return int32_t selected clock rate
+       * 
+       * @retval  >0: selected clock rate in Hz
+       * @retval  <0: error code
+       */
+      static int32_t qualifyBusClock(MCP23008 *const devices[], uint8_t count,
+                                     const uint32_t *rates = MCP23008_CLOCK_RATES,
+                                     uint8_t rateCount = sizeof(MCP23008_CLOCK_RATES) / sizeof(MCP23008_CLOCK_RATES[0]),
+                                     uint8_t rounds = 16, uint8_t backOff = 1);
+
       /* #################################### */
       /* ### --- single pin interface --- ### */
       /* #################################### */
@@ -259,6 +378,67 @@ namespace MCP23008_I2C {
        */
       int8_t write8(uint8_t value) const;
 
+      /**
+       * @brief update selected bits of the Output Latch register (OLAT)
+       * 
+       * Only the bits set in mask are taken from value, all other
+       * output latches keep their state. The register is only
+       * written when the resulting value differs from the current one.
+       * @param mask bit mask of pins to update
+       * @param value bit pattern for the selected pins
+       * @return int status of update of Output Latch register
+       * 
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int update8(uint8_t mask, uint8_t value) const;
+
+      /**
+       * @brief invert selected bits of the Output Latch register (OLAT)
+       * 
+       * @param mask bit mask of pins to toggle
+       * @return int status of write to Output Latch register
+       * 
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int toggle8(uint8_t mask) const;
+
+      /**
+       * @brief write 8-bit value to OLAT and verify it by reading back GPIO and OLAT
+       * 
+       * The write of OLAT and the sequential read of GPIO, OLAT, IODIR and
+       * IPOL (address pointer rolls over) form one bus transaction with
+       * repeated starts. Latch errors (OLAT differs from value) and pin
+       * faults (an output pin does not follow its latch) are reported
+       * separately. Latch errors and I2C errors are retried, pin faults
+       * are not.
+       * @param value value to write
+       * @param check result of verification
+       * @param retries optional number of retries; default = 0;
+       * @return int8_t status of verified write
+       * 
+       * @retval  0: state OK, outputs verified
+       * @retval <0: error code (MCP23008_ERROR_VERIFY on mismatch)
+       */
+      int8_t writeVerified8(uint8_t value, OutputCheck &check, uint8_t retries = 0) const;
+
+      /**
+       * @brief write value for a single pin and verify it by reading back GPIO and OLAT
+       * 
+       * Same as writeVerified8(), the check reports all 8 pins but
+       * only a mismatch of the written pin is returned as error.
+       * @param pin pin number of pin 0...7
+       * @param value to write 0/1
+       * @param check result of verification
+       * @param retries optional number of retries; default = 0;
+       * @return int status of verified write
+       * 
+       * @retval  0: state OK, pin verified
+       * @retval <0: error code (MCP23008_ERROR_VERIFY on mismatch)
+       */
+      int writeVerified1(uint8_t pin, uint8_t value, OutputCheck &check, uint8_t retries = 0) const;
+
       /**
        * @brief read 8 bit at once from GPIO register (GPIO)
        * 
@@ -328,6 +508,29 @@ namespace MCP23008_I2C {
        */
       int getPullup8() const;
 
+      /* #################################### */
+      /* ### ---    burst interface   --- ### */
+      /* #################################### */
+      /* Sequential transfers need the Sequential Operation mode
+       * (IOCON.SEQOP = 0, default). The address pointer rolls over
+       * from OLAT to IODIR.
+       */
+
+      /**
+       * @brief read consecutive registers in one sequential transfer
+       * 
+       * The register address is written and the registers are read
+       * after a repeated start, so the whole burst is one bus transaction.
+       * @param regAddress address of first register
+       * @param buffer buffer for register values
+       * @param count number of registers to read (1...32)
+       * @return int8_t read status
+       * 
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t readBurst(uint8_t regAddress, uint8_t *buffer, uint8_t count) const;
+
       /**
        * @brief Set the Interrupt Control Register for specified pin (INTCON)
        * 
@@ -355,6 +558,53 @@ namespace MCP23008_I2C {
        */
       int disableInterrupt(uint8_t pin) const;
 
+      /**
+       * @brief Set interrupt-on-change for all 8 pins at once (GPINTEN)
+       * 
+       * If a bit is set, the corresponding pin is enabled for
+       * interrupt-on-change.
+       * @param mask mask of pins to enable
+       * @return int8_t status
+       * 
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t setInterruptEnable8(uint8_t mask) const;
+
+      /**
+       * @brief Get interrupt-on-change for all 8 pins at once (GPINTEN)
+       * 
+       * @return int status
+       * 
+       * @retval >=0: register value
+       * @retval  <0: error code
+       */
+      int getInterruptEnable8() const;
+
+      /**
+       * @brief Set the Interrupt Control register for all 8 pins at once (INTCON)
+       * 
+       * If a bit is set, the corresponding pin is compared against
+       * the associated bit in the DEFVAL register, otherwise against
+       * its previous value.
+       * @param mask mask of pins compared against DEFVAL
+       * @return int8_t status
+       * 
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t setInterruptControl8(uint8_t mask) const;
+
+      /**
+       * @brief Get the Interrupt Control register for all 8 pins at once (INTCON)
+       * 
+       * @return int status
+       * 
+       * @retval >=0: register value
+       * @retval  <0: error code
+       */
+      int getInterruptControl8() const;
+
       /**
        * @brief Read the Interrupt Flag Register (INTF)
        * 
@@ -441,6 +691,53 @@ namespace MCP23008_I2C {
        */
       int readReg(uint8_t regAddress) const;
 
+      /**
+       * @brief end a transmission without stop, the next read follows with repeated start
+       * 
+       * Some cores (e.g. arduino-esp32 1.0.x) return a "continue" code
+       * instead of 0 for a transmission without stop, it is accepted too.
+       * 
+       * @return int8_t write status
+       *
+       * @retval =0: write OK
+       * @retval <0: error code
+       */
+      int8_t endRepeatedStart() const;
+
+      /**
+       * @brief write/read-back pattern test on the Default Compare register (DEFVAL)
+       * 
+       * The register is left with the last pattern written,
+       * the caller has to restore it.
+       * 
+       * @param rounds number of patterns to write and read back
+       * @return int number of failed rounds
+       * 
+       * @retval >=0: number of failed rounds
+       */
+      int testPattern(uint8_t rounds) const;
+
+      /**
+       * @brief read Output Latch register (OLAT), from cache if enabled
+       * 
+       * @return int read status
+       *
+       * @retval >=0: register value
+       * @retval  <0: error code
+       */
+      int readOlat() const;
+
+      /**
+       * @brief write Output Latch register (OLAT) and update the cache
+       * 
+       * @param value value to write
+       * @return int8_t write status
+       *
+       * @retval =0: write OK
+       * @retval <0: error code
+       */
+      int8_t writeOlat(uint8_t value) const;
+
       /**
        * @brief address of MCP23008 device
        * 
@@ -452,5 +749,23 @@ namespace MCP23008_I2C {
        * 
        */
       TwoWire* _wire;
+
+      /**
+       * @brief pointer of trace recorder
+       * 
+       */
+      TraceRecorder* _trace;
+
+      /**
+       * @brief cached value of Output Latch register; -1 = unknown
+       * 
+       */
+      mutable int16_t _olat;
+
+      /**
+       * @brief state of Output Latch register cache
+       * 
+       */
+      bool _outputCache;
   };
 }
\ No newline at end of file
@@ -0,0 +1,105 @@
+/**
+ * @file    MCP23008-PWM.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Bit-Angle-Modulation PWM Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-PWM.h"
+
+using namespace MCP23008_I2C;
+
+PwmEngine::PwmEngine(MCP23008 *device, uint8_t resolution, uint16_t tickMicros)
+: _device{device}, _duty{}, _planes{},
+  _resolution{static_cast<uint8_t>((resolution < 1) ? 1 : (resolution > MCP23008_PWM_MAX_RESOLUTION) ? MCP23008_PWM_MAX_RESOLUTION : resolution)},
+  _pinMask{0}, _plane{0}, _dirty{false}, _running{false},
+  _tick{(tickMicros < MCP23008_PWM_MIN_TICK) ? MCP23008_PWM_MIN_TICK : tickMicros}, _due{0}
+{}
+
+int8_t PwmEngine::begin(uint8_t pinMask) {
+  if (_device == nullptr) {
+    return MCP23008_ERROR_VALUE;
+  }
+  _device->setOutputCache(true);
+  _pinMask = pinMask;
+  for (uint8_t i = 0; i < 8; ++i) {
+    _duty[i] = 0;
+  }
+  buildFrame();
+  // start with the last plane, so the first service() call begins a new period
+  _plane = _resolution - 1;
+  _due = micros();
+  _running = true;
+  int state = _device->update8(_pinMask, 0);
+  return (state < 0) ? state : MCP23008_STATE_OK;
+}
+
+int PwmEngine::end(uint8_t level) {
+  _running = false;
+  if (_device == nullptr) {
+    return MCP23008_ERROR_VALUE;
+  }
+  return _device->update8(_pinMask, level ? _pinMask : 0);
+}
+
+int8_t PwmEngine::setDuty(uint8_t pin, uint8_t duty) {
+  if (pin > 7) {
+    return MCP23008_ERROR_PIN;
+  }
+  if (duty >= (1U << _resolution)) {
+    return MCP23008_ERROR_VALUE;
+  }
+  if (_duty[pin] != duty) {
+    _duty[pin] = duty;
+    _dirty = true;
+  }
+  return MCP23008_STATE_OK;
+}
+
+int PwmEngine::getDuty(uint8_t pin) const {
+  if (pin > 7) {
+    return MCP23008_ERROR_PIN;
+  }
+  return _duty[pin];
+}
+
+int PwmEngine::service(uint32_t nowMicros) {
+  if (!_running || (static_cast<int32_t>(nowMicros - _due) < 0)) {
+    return 0;
+  }
+  if (++_plane >= _resolution) {
+    _plane = 0;
+    // new duty cycles only take effect at the start of a period
+    if (_dirty) {
+      buildFrame();
+    }
+  }
+  _due += static_cast<uint32_t>(_tick) << _plane;
+  // resynchronize after a long stall instead of catching up
+  if (static_cast<int32_t>(nowMicros - _due) > 0) {
+    _due = nowMicros + (static_cast<uint32_t>(_tick) << _plane);
+  }
+  int state = _device->update8(_pinMask, _planes[_plane]);
+  return (state < 0) ? state : 1;
+}
+
+uint32_t PwmEngine::nextDelay(uint32_t nowMicros) const {
+  int32_t delay = static_cast<int32_t>(_due - nowMicros);
+  return (delay > 0) ? delay : 0;
+}
+
+void PwmEngine::buildFrame() {
+  for (uint8_t plane = 0; plane < _resolution; ++plane) {
+    uint8_t bits = 0;
+    for (uint8_t pin = 0; pin < 8; ++pin) {
+      if (_duty[pin] & (1 << plane)) {
+        bits |= (1 << pin);
+      }
+    }
+    _planes[plane] = bits & _pinMask;
+  }
+  _dirty = false;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file    MCP23008-PWM.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Bit-Angle-Modulation PWM Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_PWM_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief maximum resolution of PwmEngine in bits
+   *
+   */
+  constexpr uint8_t MCP23008_PWM_MAX_RESOLUTION {8};
+
+  /**
+   * @brief shortest base tick of PwmEngine in microseconds (one OLAT write of 29 bit at 400 kHz)
+   *
+   */
+  constexpr uint16_t MCP23008_PWM_MIN_TICK      {80};
+
+  /**
+   * @brief Class PwmEngine
+   *
+   * Bit-angle-modulation (BAM) PWM on the outputs of one MCP23008.
+   * A period consists of one bit plane per bit of resolution, plane n
+   * lasts 2^n base ticks. Each plane is one precomputed OLAT byte for all
+   * PWM pins, so a period costs at most resolution OLAT writes independent
+   * of the number of channels. Unchanged planes are not written.
+   *
+   * service() has to be called from loop() or from a timer callback that
+   * may use the Wire instance (not from an AVR interrupt routine). The base
+   * tick has to be longer than one OLAT write (about 290 us at 100 kHz,
+   * 75 us at 400 kHz), shorter ticks are raised to MCP23008_PWM_MIN_TICK.
+   * The PwmEngine enables the output cache of the device, other pins of
+   * the device can still be written with write1() or update8().
+   *
+   * The period is tick * (2^resolution - 1), so resolution and bus clock
+   * limit the PWM frequency; LEDs need about 50 Hz or more to not flicker:
+   *
+   * 100 kHz, tick 300 us: 6 bit = 18.9 ms (53 Hz), 8 bit = 76.5 ms (13 Hz)
+   *
+   * 400 kHz, tick  80 us: 6 bit =  5.0 ms (198 Hz), 8 bit = 20.4 ms (49 Hz)
+   */
+  class PwmEngine {
+    public:
+      /**
+       * @brief Construct a new PwmEngine object
+       *
+       * @param device pointer to MCP23008 device
+       * @param resolution resolution in bits (1...8); default = 6 (53 Hz with the default tick);
+       * @param tickMicros duration of the shortest bit plane in microseconds; default = 300 (valid at 100 kHz);
+       */
+      PwmEngine(MCP23008 *device, uint8_t resolution = 6, uint16_t tickMicros = 300);
+
+      /**
+       * @brief start PWM on the selected pins
+       *
+       * The pins have to be configured as outputs. All duty cycles start with 0.
+       *
+       * @param pinMask bit mask of PWM pins
+       * @return int8_t status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t begin(uint8_t pinMask);
+
+      /**
+       * @brief stop PWM and set all PWM pins to a fixed level
+       *
+       * @param level level of PWM pins 0/1; default = 0;
+       * @return int status of OLAT update
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int end(uint8_t level = 0);
+
+      /**
+       * @brief Set the duty cycle of a pin
+       *
+       * The new duty cycle takes effect with the next period.
+       *
+       * @param pin pin number of pin 0...7
+       * @param duty duty cycle 0...(2^resolution - 1)
+       * @return int8_t status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t setDuty(uint8_t pin, uint8_t duty);
+
+      /**
+       * @brief Get the duty cycle of a pin
+       *
+       * @param pin pin number of pin 0...7
+       * @return int duty cycle
+       *
+       * @retval >=0: duty cycle
+       * @retval  <0: error code
+       */
+      int getDuty(uint8_t pin) const;
+
+      /**
+       * @brief output the next bit plane if it is due
+       *
+       * @param nowMicros current time in microseconds (e.g. micros())
+       * @return int status
+       *
+       * @retval  1: bit plane written
+       * @retval  0: nothing to do
+       * @retval <0: error code
+       */
+      int service(uint32_t nowMicros);
+
+      /**
+       * @brief Get the time until the next bit plane is due
+       *
+       * Useful to rearm a one-shot timer after service().
+       *
+       * @param nowMicros current time in microseconds
+       * @return uint32_t time in microseconds; 0 if due
+       */
+      uint32_t nextDelay(uint32_t nowMicros) const;
+
+      /**
+       * @brief Get the duration of one PWM period
+       *
+       * @return uint32_t duration in microseconds
+       */
+      uint32_t period() const {return static_cast<uint32_t>(_tick) * ((1U << _resolution) - 1);}
+
+    private:
+      /**
+       * @brief compute bit planes from duty cycles
+       *
+       */
+      void buildFrame();
+
+      /**
+       * @brief pointer to MCP23008 device
+       *
+       */
+      MCP23008 *_device;
+
+      /**
+       * @brief duty cycle of each pin
+       *
+       */
+      uint8_t _duty[8];
+
+      /**
+       * @brief OLAT bits of each bit plane
+       *
+       */
+      uint8_t _planes[MCP23008_PWM_MAX_RESOLUTION];
+
+      /**
+       * @brief resolution in bits
+       *
+       */
+      uint8_t _resolution;
+
+      /**
+       * @brief bit mask of PWM pins
+       *
+       */
+      uint8_t _pinMask;
+
+      /**
+       * @brief index of current bit plane
+       *
+       */
+      uint8_t _plane;
+
+      /**
+       * @brief duty cycles changed since last frame
+       *
+       */
+      bool _dirty;
+
+      /**
+       * @brief PWM is running
+       *
+       */
+      bool _running;
+
+      /**
+       * @brief duration of shortest bit plane in microseconds
+       *
+       */
+      uint16_t _tick;
+
+      /**
+       * @brief start time of next bit plane
+       *
+       */
+      uint32_t _due;
+  };
+}
@@ -0,0 +1,69 @@
+/**
+ * @file    MCP23008-Pin.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Pin Handle Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-I2C.h"
+
+using namespace MCP23008_I2C;
+
+int NativePin::mode(uint8_t mode) const {
+  pinMode(_pin, mode);
+  return MCP23008_STATE_OK;
+}
+
+int NativePin::write(uint8_t value) const {
+  digitalWrite(_pin, value ? HIGH : LOW);
+  return MCP23008_STATE_OK;
+}
+
+int NativePin::read() const {
+  return digitalRead(_pin) == HIGH ? 1 : 0;
+}
+
+int NativePin::toggle() const {
+  digitalWrite(_pin, digitalRead(_pin) == HIGH ? LOW : HIGH);
+  return MCP23008_STATE_OK;
+}
+
+int ExpanderPin::mode(uint8_t mode) const {
+  if (_mask == 0) {
+    return MCP23008_ERROR_PIN;
+  }
+  int state = _device->setPinMode1(_pin, mode);
+  if ((state < 0) || (mode == OUTPUT)) {
+    return state;
+  }
+  // same as Arduino: INPUT_PULLUP enables, INPUT disables the Pull-up
+  return _device->setPullup(_pin, mode == INPUT_PULLUP);
+}
+
+int ExpanderPin::write(uint8_t value) const {
+  if (_mask == 0) {
+    return MCP23008_ERROR_PIN;
+  }
+  return _device->update8(_mask, value ? _mask : 0);
+}
+
+int ExpanderPin::read() const {
+  if (_mask == 0) {
+    return MCP23008_ERROR_PIN;
+  }
+  int gpio = _device->read8();
+  if (gpio < 0) {
+    return gpio;
+  }
+  return (gpio & _mask) ? 1 : 0;
+}
+
+int ExpanderPin::toggle() const {
+  if (_mask == 0) {
+    return MCP23008_ERROR_PIN;
+  }
+  return _device->toggle8(_mask);
+}
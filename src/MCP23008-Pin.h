@@ -0,0 +1,160 @@
+/**
+ * @file    MCP23008-Pin.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Pin Handle Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_PIN_H__
+
+#include "Arduino.h"
+
+namespace MCP23008_I2C {
+
+  class MCP23008;
+
+  /**
+   * @brief Class DigitalPin
+   *
+   * Common interface of native and expander pins, so code can drive
+   * both kinds of pins generically.
+   */
+  class DigitalPin {
+    public:
+      /**
+       * @brief set pinMode of pin
+       *
+       * @param mode mode of pin (INPUT, INPUT_PULLUP, OUTPUT)
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      virtual int mode(uint8_t mode) const = 0;
+
+      /**
+       * @brief write value of pin
+       *
+       * @param value to write 0/1
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      virtual int write(uint8_t value) const = 0;
+
+      /**
+       * @brief read value of pin
+       *
+       * @return int state of pin
+       *
+       * @retval  0: pin is in LOW state
+       * @retval  1: pin is in HIGH state
+       * @retval <0: error code
+       */
+      virtual int read() const = 0;
+
+      /**
+       * @brief invert output value of pin
+       *
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      virtual int toggle() const = 0;
+
+    protected:
+      ~DigitalPin() = default;
+  };
+
+  /**
+   * @brief Class NativePin
+   *
+   * DigitalPin of the microcontroller itself.
+   */
+  class NativePin : public DigitalPin {
+    public:
+      /**
+       * @brief Construct a new NativePin object
+       *
+       * @param pin Arduino pin number
+       */
+      explicit NativePin(uint8_t pin) : _pin{pin} {}
+
+      int mode(uint8_t mode) const override;
+      int write(uint8_t value) const override;
+      int read() const override;
+      int toggle() const override;
+
+    private:
+      /**
+       * @brief Arduino pin number
+       *
+       */
+      uint8_t _pin;
+  };
+
+  /**
+   * @brief Class ExpanderPin
+   *
+   * DigitalPin of a MCP23008. The handle keeps the device pointer and the
+   * bit mask of the pin, so the pin number is only checked once. Combined
+   * with the output cache of the device (MCP23008::setOutputCache())
+   * write() and toggle() cost one OLAT write and no read.
+   */
+  class ExpanderPin : public DigitalPin {
+    public:
+      /**
+       * @brief Construct a new ExpanderPin object
+       *
+       * @param device pointer to MCP23008 device
+       * @param pin pin number of pin 0...7
+       */
+      ExpanderPin(MCP23008 *device, uint8_t pin)
+      : _device{device}, _pin{pin}, _mask{static_cast<uint8_t>(pin > 7 ? 0 : 1 << pin)} {}
+
+      int mode(uint8_t mode) const override;
+      int write(uint8_t value) const override;
+      int read() const override;
+      int toggle() const override;
+
+      /**
+       * @brief Get the device of pin
+       *
+       * @return MCP23008* pointer to MCP23008 device
+       */
+      MCP23008* getDevice() const {return _device;}
+
+      /**
+       * @brief Get the bit mask of pin
+       *
+       * @return uint8_t bit mask; 0 = invalid pin
+       */
+      uint8_t getMask() const {return _mask;}
+
+    private:
+      /**
+       * @brief pointer to MCP23008 device
+       *
+       */
+      MCP23008 *_device;
+
+      /**
+       * @brief pin number of pin
+       *
+       */
+      uint8_t _pin;
+
+      /**
+       * @brief bit mask of pin; 0 = invalid pin
+       *
+       */
+      uint8_t _mask;
+  };
+}
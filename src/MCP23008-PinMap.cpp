@@ -0,0 +1,99 @@
+/**
+ * @file    MCP23008-PinMap.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Logical to Physical Pin Mapping Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-PinMap.h"
+
+using namespace MCP23008_I2C;
+
+LogicalPort::LogicalPort(MCP23008 *device, const PinMap &map)
+: _single{device, &map}, _segments{nullptr}, _count{1}
+{}
+
+LogicalPort::LogicalPort(const PortSegment *segments, uint8_t count)
+: _single{nullptr, nullptr}, _segments{segments}, _count{count}
+{}
+
+int LogicalPort::setPinMode8(uint8_t mask) const {
+  for (uint8_t i = 0; i < _count; ++i) {
+    const PortSegment &segment = segmentAt(i);
+    uint8_t used = segment.map->mask();
+    int iodir = segment.map->scatter(mask);
+    if (used != 0xFF) {
+      // keep the direction of pins which do not belong to the port
+      int reg = segment.device->getPinMode8();
+      if (reg < 0) {
+        return reg;
+      }
+      iodir |= reg & ~used;
+    }
+    int state = segment.device->setPinMode8(iodir);
+    if (state < 0) {
+      return state;
+    }
+  }
+  return MCP23008_STATE_OK;
+}
+
+int LogicalPort::write8(uint8_t value) const {
+  for (uint8_t i = 0; i < _count; ++i) {
+    const PortSegment &segment = segmentAt(i);
+    uint8_t used = segment.map->mask();
+    // a port covering all pins of a device needs no read of OLAT
+    int state = (used == 0xFF) ? segment.device->write8(segment.map->scatter(value))
+                               : segment.device->update8(used, segment.map->scatter(value));
+    if (state < 0) {
+      return state;
+    }
+  }
+  return MCP23008_STATE_OK;
+}
+
+int LogicalPort::update8(uint8_t mask, uint8_t value) const {
+  for (uint8_t i = 0; i < _count; ++i) {
+    const PortSegment &segment = segmentAt(i);
+    uint8_t physical = segment.map->scatter(mask);
+    if (physical == 0) {
+      continue;
+    }
+    int state = segment.device->update8(physical, segment.map->scatter(value));
+    if (state < 0) {
+      return state;
+    }
+  }
+  return MCP23008_STATE_OK;
+}
+
+int LogicalPort::toggle8(uint8_t mask) const {
+  for (uint8_t i = 0; i < _count; ++i) {
+    const PortSegment &segment = segmentAt(i);
+    uint8_t physical = segment.map->scatter(mask);
+    if (physical == 0) {
+      continue;
+    }
+    int state = segment.device->toggle8(physical);
+    if (state < 0) {
+      return state;
+    }
+  }
+  return MCP23008_STATE_OK;
+}
+
+int LogicalPort::read8() const {
+  uint8_t value = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    const PortSegment &segment = segmentAt(i);
+    int gpio = segment.device->read8();
+    if (gpio < 0) {
+      return gpio;
+    }
+    value |= segment.map->gather(gpio);
+  }
+  return value;
+}
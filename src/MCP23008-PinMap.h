@@ -0,0 +1,348 @@
+/**
+ * @file    MCP23008-PinMap.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Logical to Physical Pin Mapping Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_PINMAP_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief physical pin value for a logical pin which is not mapped
+   *
+   */
+  constexpr uint8_t MCP23008_PIN_UNUSED {0x0F};
+
+  /**
+   * @brief Class PinMap
+   *
+   * Maps the 8 logical pins of a port to the physical pins of one MCP23008.
+   * The map is compiled into lookup tables for each nibble, so translating
+   * a whole byte costs two table lookups in each direction.
+   *
+   * Declare maps constexpr to build the tables at compile time:
+   *
+   * constexpr MCP23008_I2C::PinMap map {7, 6, 5, 4, 0, 1, 2, 3};
+   * static_assert(map.valid(), "invalid pin map");
+   */
+  class PinMap {
+    public:
+      /**
+       * @brief Construct a new PinMap object
+       *
+       * @param p0...p7 physical pin 0...7 of logical pin 0...7 or MCP23008_PIN_UNUSED;
+       *        other values make the map invalid, the logical pin is not mapped
+       */
+      constexpr PinMap(uint8_t p0, uint8_t p1, uint8_t p2, uint8_t p3,
+                       uint8_t p4, uint8_t p5, uint8_t p6, uint8_t p7)
+      : PinMap{pack(p0, 0) | pack(p1, 1) | pack(p2, 2) | pack(p3, 3) |
+               pack(p4, 4) | pack(p5, 5) | pack(p6, 6) | pack(p7, 7)} {}
+
+      /**
+       * @brief translate logical bit pattern to physical bit pattern
+       *
+       * @param logical logical bit pattern
+       * @return uint8_t physical bit pattern
+       */
+      constexpr uint8_t scatter(uint8_t logical) const {
+        return _scatterLow.entry[logical & 0x0F] | _scatterHigh.entry[logical >> 4];
+      }
+
+      /**
+       * @brief translate physical bit pattern to logical bit pattern
+       *
+       * @param physical physical bit pattern
+       * @return uint8_t logical bit pattern
+       */
+      constexpr uint8_t gather(uint8_t physical) const {
+        return _gatherLow.entry[physical & 0x0F] | _gatherHigh.entry[physical >> 4];
+      }
+
+      /**
+       * @brief Get the physical pins used by the map
+       *
+       * @return uint8_t physical bit mask
+       */
+      constexpr uint8_t mask() const {return scatter(0xFF);}
+
+      /**
+       * @brief Get the logical pins which are mapped
+       *
+       * @return uint8_t logical bit mask
+       */
+      constexpr uint8_t logicalMask() const {return gather(mask());}
+
+      /**
+       * @brief Get the physical pin of a logical pin
+       *
+       * @param logical logical pin 0...7
+       * @return uint8_t physical pin 0...7, MCP23008_PIN_UNUSED or a value above 7 for an invalid pin
+       */
+      constexpr uint8_t physicalPin(uint8_t logical) const {return pin(_pins, logical & 0x07);}
+
+      /**
+       * @brief check that all physical pins are in range (0...7 or MCP23008_PIN_UNUSED) and used only once
+       *
+       * @return true map is valid
+       * @return false map is invalid
+       */
+      constexpr bool valid() const {return validFrom(_pins, 0);}
+
+    private:
+      /**
+       * @brief packed value of a physical pin which is out of range
+       *
+       */
+      static constexpr uint8_t PIN_INVALID {0x08};
+
+      /**
+       * @brief lookup table for one nibble
+       *
+       */
+      struct Table {
+        constexpr Table(uint32_t pins, uint8_t base, bool gather)
+        : entry{value(pins, base, gather, 0),  value(pins, base, gather, 1),
+                value(pins, base, gather, 2),  value(pins, base, gather, 3),
+                value(pins, base, gather, 4),  value(pins, base, gather, 5),
+                value(pins, base, gather, 6),  value(pins, base, gather, 7),
+                value(pins, base, gather, 8),  value(pins, base, gather, 9),
+                value(pins, base, gather, 10), value(pins, base, gather, 11),
+                value(pins, base, gather, 12), value(pins, base, gather, 13),
+                value(pins, base, gather, 14), value(pins, base, gather, 15)} {}
+
+        static constexpr uint8_t value(uint32_t pins, uint8_t base, bool gather, uint8_t n) {
+          return gather ? gatherEntry(pins, base, n) : scatterEntry(pins, base, n);
+        }
+
+        uint8_t entry[16];
+      };
+
+      /**
+       * @brief Construct a new PinMap object from packed pins
+       *
+       * @param pins physical pins, 4 bit per logical pin
+       */
+      constexpr explicit PinMap(uint32_t pins)
+      : _pins{pins},
+        _scatterLow{pins, 0, false}, _scatterHigh{pins, 4, false},
+        _gatherLow{pins, 0, true}, _gatherHigh{pins, 4, true} {}
+
+      /**
+       * @brief pack physical pin of logical pin, an out of range value is kept as PIN_INVALID for valid()
+       *
+       */
+      static constexpr uint32_t pack(uint8_t physical, uint8_t logical) {
+        return static_cast<uint32_t>(((physical > 7) && (physical != MCP23008_PIN_UNUSED)) ? PIN_INVALID : physical)
+               << (4 * logical);
+      }
+
+      static constexpr uint8_t pin(uint32_t pins, uint8_t logical) {
+        return (pins >> (4 * logical)) & 0x0F;
+      }
+
+      /**
+       * @brief move bit from of value to bit to, nothing for an unused pin
+       *
+       */
+      static constexpr uint8_t move(uint8_t value, uint8_t from, uint8_t to) {
+        return (to > 7) ? 0 : static_cast<uint8_t>(((value >> from) & 0x01) << to);
+      }
+
+      /**
+       * @brief physical bits for logical nibble n of logical pins base...base+3
+       *
+       */
+      static constexpr uint8_t scatterEntry(uint32_t pins, uint8_t base, uint8_t n) {
+        return move(n, 0, pin(pins, base))     | move(n, 1, pin(pins, base + 1)) |
+               move(n, 2, pin(pins, base + 2)) | move(n, 3, pin(pins, base + 3));
+      }
+
+      /**
+       * @brief logical bit of logical pin for physical nibble n of physical pins base...base+3
+       *
+       */
+      static constexpr uint8_t gatherBit(uint32_t pins, uint8_t base, uint8_t n, uint8_t logical) {
+        return ((pin(pins, logical) >= base) && (pin(pins, logical) < base + 4))
+               ? move(n, pin(pins, logical) - base, logical) : 0;
+      }
+
+      static constexpr uint8_t gatherEntry(uint32_t pins, uint8_t base, uint8_t n) {
+        return gatherBit(pins, base, n, 0) | gatherBit(pins, base, n, 1) |
+               gatherBit(pins, base, n, 2) | gatherBit(pins, base, n, 3) |
+               gatherBit(pins, base, n, 4) | gatherBit(pins, base, n, 5) |
+               gatherBit(pins, base, n, 6) | gatherBit(pins, base, n, 7);
+      }
+
+      /**
+       * @brief true if physical pin of logical pin is not used by a later logical pin
+       *
+       */
+      static constexpr bool uniqueFrom(uint32_t pins, uint8_t logical, uint8_t other) {
+        return (other > 7) || (((pin(pins, logical) == MCP23008_PIN_UNUSED) || (pin(pins, logical) != pin(pins, other)))
+                               && uniqueFrom(pins, logical, other + 1));
+      }
+
+      static constexpr bool validFrom(uint32_t pins, uint8_t logical) {
+        return (logical > 7) || ((pin(pins, logical) != PIN_INVALID) && uniqueFrom(pins, logical, logical + 1)
+                                 && validFrom(pins, logical + 1));
+      }
+
+      /**
+       * @brief physical pins, 4 bit per logical pin
+       *
+       */
+      uint32_t _pins;
+
+      /**
+       * @brief lookup tables logical to physical (low and high nibble)
+       *
+       */
+      Table _scatterLow;
+      Table _scatterHigh;
+
+      /**
+       * @brief lookup tables physical to logical (low and high nibble)
+       *
+       */
+      Table _gatherLow;
+      Table _gatherHigh;
+  };
+
+  /**
+   * @brief Part of a logical port on one device
+   *
+   */
+  struct PortSegment {
+    /**
+     * @brief pointer to MCP23008 device
+     *
+     */
+    MCP23008 *device;
+
+    /**
+     * @brief pin map of device, unused logical pins belong to other segments
+     *
+     */
+    const PinMap *map;
+  };
+
+  /**
+   * @brief Class LogicalPort
+   *
+   * 8-bit port whose logical pins are mapped to physical pins of one or
+   * more MCP23008 devices. Every port operation costs one register access
+   * per device instead of one transaction per pin. With the output cache
+   * of the devices enabled (MCP23008::setOutputCache()) a write needs no
+   * reads. The port keeps pointers to the segments and maps, they have
+   * to stay valid as long as the port is used.
+   */
+  class LogicalPort {
+    public:
+      /**
+       * @brief Construct a new LogicalPort object on one device
+       *
+       * @param device pointer to MCP23008 device
+       * @param map pin map
+       */
+      LogicalPort(MCP23008 *device, const PinMap &map);
+
+      /**
+       * @brief Construct a new LogicalPort object on several devices
+       *
+       * @param segments array of segments
+       * @param count number of segments
+       */
+      LogicalPort(const PortSegment *segments, uint8_t count);
+
+      /**
+       * @brief set pinMode of logical pins (IODIR)
+       *
+       * @param mask logical bit mask, 1 = input, 0 = output
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int setPinMode8(uint8_t mask) const;
+
+      /**
+       * @brief write logical 8-bit value (OLAT)
+       *
+       * @param value logical bit pattern
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int write8(uint8_t value) const;
+
+      /**
+       * @brief update selected logical pins (OLAT)
+       *
+       * @param mask logical bit mask of pins to update
+       * @param value logical bit pattern
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int update8(uint8_t mask, uint8_t value) const;
+
+      /**
+       * @brief invert selected logical pins (OLAT)
+       *
+       * @param mask logical bit mask of pins to toggle
+       * @return int status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int toggle8(uint8_t mask) const;
+
+      /**
+       * @brief read logical 8-bit value (GPIO)
+       *
+       * @return int logical bit pattern
+       *
+       * @retval >=0: logical value
+       * @retval  <0: error code
+       */
+      int read8() const;
+
+    private:
+      /**
+       * @brief Get a segment of port
+       *
+       * @param index index of segment
+       * @return const PortSegment& segment
+       */
+      const PortSegment& segmentAt(uint8_t index) const {return _segments ? _segments[index] : _single;}
+
+      /**
+       * @brief segment of the single device constructor
+       *
+       */
+      PortSegment _single;
+
+      /**
+       * @brief array of segments; nullptr = single device
+       *
+       */
+      const PortSegment *_segments;
+
+      /**
+       * @brief number of segments
+       *
+       */
+      uint8_t _count;
+  };
+}
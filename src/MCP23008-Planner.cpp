@@ -0,0 +1,143 @@
+/**
+ * @file    MCP23008-Planner.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Bus Budget Planner Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-Planner.h"
+
+using namespace MCP23008_I2C;
+
+BusPlanner::BusPlanner(uint32_t clock, uint16_t overheadMicros)
+: _jobs{}, _count{0}, _warning{700}, _overhead{overheadMicros}, _clock{clock ? clock : 1}
+{}
+
+uint32_t BusPlanner::operationTime(uint8_t operation, uint8_t count, uint32_t clock, uint16_t overheadMicros) {
+  uint32_t bits;
+  uint8_t transactions = 1;
+  switch (operation) {
+    case MCP23008_OP_READ:
+      // S, address, register, Sr, address, data, P
+      bits = 39;
+      break;
+    case MCP23008_OP_WRITE:
+      // S, address, register, data, P
+      bits = 29;
+      break;
+    case MCP23008_OP_READ_MODIFY_WRITE:
+      bits = 39 + 29;
+      transactions = 2;
+      break;
+    case MCP23008_OP_BURST:
+      bits = 30 + 9 * static_cast<uint32_t>(count);
+      break;
+    case MCP23008_OP_VERIFIED_WRITE:
+      // S, address, OLAT, data, Sr, address, GPIO, Sr, address, 4 data, P
+      bits = 28 + 19 + 47;
+      break;
+    default:
+      return 0;
+  }
+  if (clock == 0) {
+    return 0;
+  }
+  return (bits * 1000000 + clock - 1) / clock + static_cast<uint32_t>(transactions) * overheadMicros;
+}
+
+int BusPlanner::addJob(const MCP23008 *device, uint8_t operation, uint32_t periodMicros, uint8_t count) {
+  if ((operation > MCP23008_OP_VERIFIED_WRITE) || (periodMicros == 0) || (count == 0) || (count > 32)) {
+    return MCP23008_ERROR_VALUE;
+  }
+  if (_count >= MCP23008_PLANNER_JOBS) {
+    return MCP23008_ERROR_FULL;
+  }
+  _jobs[_count] = Job{device, periodMicros, operation, count};
+  BusBudget budget;
+  if (analyze(budget, _count + 1) < 0) {
+    // reject, the job is not taken over
+    return MCP23008_ERROR_OVERLOAD;
+  }
+  return _count++;
+}
+
+int8_t BusPlanner::analyze(BusBudget &budget) const {
+  return analyze(budget, _count);
+}
+
+int8_t BusPlanner::analyze(BusBudget &budget, uint8_t jobs) const {
+  budget.utilization = 0;
+  budget.worstLatency = 0;
+  budget.criticalJob = 0;
+  budget.state = MCP23008_STATE_OK;
+
+  uint32_t utilization = 0;
+  float worstRatio = 0.0f;
+  for (uint8_t i = 0; i < jobs; ++i) {
+    uint32_t time = operationTime(_jobs[i].operation, _jobs[i].count, _clock, _overhead);
+    utilization += (time * 1000 + _jobs[i].period - 1) / _jobs[i].period;
+
+    uint32_t latency = responseTime(i, jobs);
+    float ratio = latency ? static_cast<float>(latency) / _jobs[i].period : 2.0f;
+    if (ratio > worstRatio) {
+      worstRatio = ratio;
+      budget.criticalJob = i;
+    }
+    if (latency == 0) {
+      budget.state = MCP23008_ERROR_OVERLOAD;
+    }
+    else if (latency > budget.worstLatency) {
+      budget.worstLatency = latency;
+    }
+  }
+  budget.utilization = (utilization > 0xFFFF) ? 0xFFFF : utilization;
+  if (utilization > 1000) {
+    budget.state = MCP23008_ERROR_OVERLOAD;
+  }
+  if ((budget.state == MCP23008_STATE_OK) && (utilization > _warning)) {
+    budget.state = MCP23008_STATE_WARNING;
+  }
+  return budget.state;
+}
+
+uint32_t BusPlanner::responseTime(uint8_t index, uint8_t jobs) const {
+  const Job &job = _jobs[index];
+  uint32_t own = operationTime(job.operation, job.count, _clock, _overhead);
+
+  // waiting time: every other job released until the bus gets free runs first
+  uint32_t wait = 0;
+  for (uint8_t i = 0; i < 255; ++i) {
+    uint32_t next = 0;
+    for (uint8_t j = 0; j < jobs; ++j) {
+      if (j != index) {
+        next += (wait / _jobs[j].period + 1) * operationTime(_jobs[j].operation, _jobs[j].count, _clock, _overhead);
+      }
+    }
+    if (next + own > job.period) {
+      return 0;
+    }
+    if (next == wait) {
+      return wait + own;
+    }
+    wait = next;
+  }
+  // no fixed point found
+  return 0;
+}
+
+uint32_t BusPlanner::jobTime(uint8_t index) const {
+  if (index >= _count) {
+    return 0;
+  }
+  return operationTime(_jobs[index].operation, _jobs[index].count, _clock, _overhead);
+}
+
+uint32_t BusPlanner::jobLatency(uint8_t index) const {
+  if (index >= _count) {
+    return 0;
+  }
+  return responseTime(index, _count);
+}
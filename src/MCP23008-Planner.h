@@ -0,0 +1,257 @@
+/**
+ * @file    MCP23008-Planner.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Bus Budget Planner Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_PLANNER_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief maximum number of jobs of one planner
+   *
+   */
+  constexpr uint8_t MCP23008_PLANNER_JOBS          {16};
+
+  /**
+   * @brief operation: read one register, e.g. read8(), getPinMode8()
+   *
+   */
+  constexpr uint8_t MCP23008_OP_READ               {0};
+
+  /**
+   * @brief operation: write one register, e.g. write8(), setPinMode8(), cached write1()
+   *
+   */
+  constexpr uint8_t MCP23008_OP_WRITE              {1};
+
+  /**
+   * @brief operation: read and write one register, e.g. write1(), update8() without output cache
+   *
+   */
+  constexpr uint8_t MCP23008_OP_READ_MODIFY_WRITE  {2};
+
+  /**
+   * @brief operation: sequential read of count registers, e.g. readBurst(), PulseCounter service (3)
+   *
+   */
+  constexpr uint8_t MCP23008_OP_BURST              {3};
+
+  /**
+   * @brief operation: write with read back of 4 registers, writeVerified8(), writeVerified1() with output cache
+   *
+   */
+  constexpr uint8_t MCP23008_OP_VERIFIED_WRITE     {4};
+
+  /**
+   * @brief analysis state: bus utilization above the warning threshold
+   *
+   */
+  constexpr int8_t MCP23008_STATE_WARNING          {1};
+
+  /**
+   * @brief Result of a bus budget analysis
+   *
+   */
+  struct BusBudget {
+    /**
+     * @brief bus utilization in per mille
+     *
+     */
+    uint16_t utilization;
+
+    /**
+     * @brief worst-case latency of all jobs in microseconds
+     *
+     */
+    uint32_t worstLatency;
+
+    /**
+     * @brief index of job with the worst latency relative to its period
+     *
+     */
+    uint8_t criticalJob;
+
+    /**
+     * @brief state of analysis: MCP23008_STATE_OK, MCP23008_STATE_WARNING or MCP23008_ERROR_OVERLOAD
+     *
+     */
+    int8_t state;
+  };
+
+  /**
+   * @brief Class BusPlanner
+   *
+   * Checks a set of periodic bus jobs against the capacity of one I2C bus.
+   * The bus time of every job is computed from the transaction model of
+   * the library (bits per transaction at the configured clock plus a fixed
+   * overhead per transaction for the driver):
+   *
+   * write = 29 bit, read = 39 bit (repeated start), read-modify-write = 68 bit,
+   * burst of n registers = 30 + 9 * n bit, verified write = 94 bit.
+   *
+   * The worst-case latency of a job is computed with a response-time
+   * analysis of the non-preemptive bus: a job may have to wait for all
+   * other jobs released meanwhile. A schedule is overloaded if the
+   * utilization exceeds 100 % or a job can not complete within its period.
+   */
+  class BusPlanner {
+    public:
+      /**
+       * @brief Construct a new BusPlanner object
+       *
+       * @param clock I2C clock in Hz; default = 100000;
+       * @param overheadMicros driver overhead per transaction in microseconds; default = 0;
+       */
+      explicit BusPlanner(uint32_t clock = 100000, uint16_t overheadMicros = 0);
+
+      /**
+       * @brief Set the I2C clock, e.g. the result of MCP23008::qualifyBusClock()
+       *
+       * @param clock I2C clock in Hz
+       */
+      void setClock(uint32_t clock) {_clock = clock ? clock : 1;}
+
+      /**
+       * @brief Set the utilization which causes a warning
+       *
+       * @param perMille utilization in per mille; default = 700;
+       */
+      void setWarningThreshold(uint16_t perMille) {_warning = perMille;}
+
+      /**
+       * @brief add a periodic job, it is rejected if the schedule gets overloaded
+       *
+       * @param device pointer to MCP23008 device (for reference only)
+       * @param operation operation MCP23008_OP_*
+       * @param periodMicros period in microseconds
+       * @param count number of registers of a burst; default = 1;
+       * @return int index of job
+       *
+       * @retval >=0: index of job
+       * @retval  <0: error code
+       */
+      int addJob(const MCP23008 *device, uint8_t operation, uint32_t periodMicros, uint8_t count = 1);
+
+      /**
+       * @brief remove all jobs
+       *
+       */
+      void clear() {_count = 0;}
+
+      /**
+       * @brief analyze the current set of jobs
+       *
+       * @param budget result of analysis
+       * @return int8_t state of analysis
+       *
+       * @retval  1: warning, utilization above threshold
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t analyze(BusBudget &budget) const;
+
+      /**
+       * @brief Get the bus time of a job
+       *
+       * @param index index of job
+       * @return uint32_t bus time in microseconds; 0 for invalid index
+       */
+      uint32_t jobTime(uint8_t index) const;
+
+      /**
+       * @brief Get the worst-case latency of a job
+       *
+       * @param index index of job
+       * @return uint32_t latency in microseconds; 0 for invalid index or if the job can not complete in time
+       */
+      uint32_t jobLatency(uint8_t index) const;
+
+      /**
+       * @brief Get the number of jobs
+       *
+       * @return uint8_t number of jobs
+       */
+      uint8_t count() const {return _count;}
+
+      /**
+       * @brief Get the bus time of one operation
+       *
+       * @param operation operation MCP23008_OP_*
+       * @param count number of registers of a burst
+       * @param clock I2C clock in Hz
+       * @param overheadMicros driver overhead per transaction in microseconds
+       * @return uint32_t bus time in microseconds (rounded up); 0 for invalid operation
+       */
+      static uint32_t operationTime(uint8_t operation, uint8_t count, uint32_t clock, uint16_t overheadMicros = 0);
+
+    private:
+      /**
+       * @brief periodic job
+       *
+       */
+      struct Job {
+        const MCP23008 *device;
+        uint32_t period;
+        uint8_t operation;
+        uint8_t count;
+      };
+
+      /**
+       * @brief worst-case response time of a job
+       *
+       * @param index index of job
+       * @param jobs number of jobs to consider
+       * @return uint32_t response time in microseconds; 0 if it exceeds the period
+       */
+      uint32_t responseTime(uint8_t index, uint8_t jobs) const;
+
+      /**
+       * @brief analyze the first jobs
+       *
+       * @param budget result of analysis
+       * @param jobs number of jobs to consider
+       * @return int8_t state of analysis
+       */
+      int8_t analyze(BusBudget &budget, uint8_t jobs) const;
+
+      /**
+       * @brief jobs
+       *
+       */
+      Job _jobs[MCP23008_PLANNER_JOBS];
+
+      /**
+       * @brief number of jobs
+       *
+       */
+      uint8_t _count;
+
+      /**
+       * @brief utilization warning threshold in per mille
+       *
+       */
+      uint16_t _warning;
+
+      /**
+       * @brief driver overhead per transaction in microseconds
+       *
+       */
+      uint16_t _overhead;
+
+      /**
+       * @brief I2C clock in Hz
+       *
+       */
+      uint32_t _clock;
+  };
+}
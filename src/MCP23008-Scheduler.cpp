@@ -0,0 +1,181 @@
+/**
+ * @file    MCP23008-Scheduler.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Output Scheduler Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-Scheduler.h"
+
+using namespace MCP23008_I2C;
+
+static_assert((MCP23008_SCHEDULER_SLOTS & (MCP23008_SCHEDULER_SLOTS - 1)) == 0,
+              "number of scheduler slots must be a power of two");
+
+OutputScheduler::OutputScheduler()
+: _free{0}, _count{0}, _lastTick{0}, _started{false}
+{
+  clear();
+}
+
+void OutputScheduler::clear() {
+  for (uint8_t i = 0; i < MCP23008_SCHEDULER_SLOTS; ++i) {
+    _slots[i] = NONE;
+  }
+  for (uint8_t i = 0; i < MCP23008_SCHEDULER_ACTIONS; ++i) {
+    _actions[i].next = i + 1;
+  }
+  _actions[MCP23008_SCHEDULER_ACTIONS - 1].next = NONE;
+  _free = 0;
+  _count = 0;
+}
+
+int8_t OutputScheduler::schedule(MCP23008 *device, uint8_t pin, uint8_t level, uint32_t due) {
+  if (pin > 7) {
+    return MCP23008_ERROR_PIN;
+  }
+  if (device == nullptr) {
+    return MCP23008_ERROR_VALUE;
+  }
+  if (_free == NONE) {
+    return MCP23008_ERROR_FULL;
+  }
+  // actions already overdue are executed with the next tick
+  if (static_cast<int32_t>(due - _lastTick) <= 0) {
+    due = _lastTick + 1;
+  }
+  uint8_t index = _free;
+  Action &action = _actions[index];
+  _free = action.next;
+
+  action.device = device;
+  action.due = due;
+  action.mask = 1 << pin;
+  action.level = level ? 1 : 0;
+  action.next = NONE;
+
+  // append to keep the order of actions with the same due time
+  uint8_t *link = &_slots[due & (MCP23008_SCHEDULER_SLOTS - 1)];
+  while (*link != NONE) {
+    link = &_actions[*link].next;
+  }
+  *link = index;
+  ++_count;
+  return MCP23008_STATE_OK;
+}
+
+int8_t OutputScheduler::scheduleIn(MCP23008 *device, uint8_t pin, uint8_t level, uint32_t delay) {
+  if (!_started) {
+    // no time base yet, _lastTick is not related to the caller's clock
+    return MCP23008_ERROR_VALUE;
+  }
+  return schedule(device, pin, level, _lastTick + delay);
+}
+
+int OutputScheduler::cancel(MCP23008 *device, uint8_t pin) {
+  if (pin > 7) {
+    return MCP23008_ERROR_PIN;
+  }
+  uint8_t mask = 1 << pin;
+  int removed = 0;
+  for (uint8_t slot = 0; slot < MCP23008_SCHEDULER_SLOTS; ++slot) {
+    uint8_t *link = &_slots[slot];
+    while (*link != NONE) {
+      uint8_t index = *link;
+      Action &action = _actions[index];
+      if ((action.device == device) && (action.mask == mask)) {
+        *link = action.next;
+        action.next = _free;
+        _free = index;
+        --_count;
+        ++removed;
+      }
+      else {
+        link = &action.next;
+      }
+    }
+  }
+  return removed;
+}
+
+int OutputScheduler::tick(uint32_t now) {
+  uint32_t elapsed = now - _lastTick;
+  if (_started && ((elapsed == 0) || (static_cast<int32_t>(elapsed) < 0))) {
+    return 0;
+  }
+  _started = true;
+  // each wheel slot needs to be visited at most once per tick
+  uint8_t steps = (elapsed < MCP23008_SCHEDULER_SLOTS) ? elapsed : MCP23008_SCHEDULER_SLOTS;
+
+  Update updates[MCP23008_SCHEDULER_ACTIONS];
+  uint8_t count = 0;
+  for (uint8_t i = 1; i <= steps; ++i) {
+    collect((_lastTick + i) & (MCP23008_SCHEDULER_SLOTS - 1), now, updates, count);
+  }
+  _lastTick = now;
+
+  // merge the pin updates of each device into one OLAT update
+  int state = MCP23008_STATE_OK;
+  int devices = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    MCP23008 *device = updates[i].device;
+    if (device == nullptr) {
+      continue;
+    }
+    uint8_t mask = 0;
+    uint8_t value = 0;
+    for (uint8_t j = i; j < count; ++j) {
+      if (updates[j].device == device) {
+        mask |= updates[j].mask;
+        if (updates[j].level) {
+          value |= updates[j].mask;
+        }
+        updates[j].device = nullptr;
+      }
+    }
+    int result = device->update8(mask, value);
+    if ((result < 0) && (state == MCP23008_STATE_OK)) {
+      state = result;
+    }
+    ++devices;
+  }
+  if (state < 0) {
+    return state;
+  }
+  return devices;
+}
+
+void OutputScheduler::collect(uint8_t slot, uint32_t now, Update *updates, uint8_t &count) {
+  uint8_t *link = &_slots[slot];
+  while (*link != NONE) {
+    uint8_t index = *link;
+    Action &action = _actions[index];
+    if (static_cast<int32_t>(action.due - now) > 0) {
+      // due in a later round of the wheel
+      link = &action.next;
+      continue;
+    }
+    // slots are not visited in order of due time if more than one
+    // round elapsed, so keep the latest due action of each pin
+    uint8_t i = 0;
+    while ((i < count) && ((updates[i].device != action.device) || (updates[i].mask != action.mask))) {
+      ++i;
+    }
+    if (i == count) {
+      updates[i] = Update{action.device, action.due, action.mask, action.level};
+      ++count;
+    }
+    else if (static_cast<int32_t>(action.due - updates[i].due) >= 0) {
+      updates[i].due = action.due;
+      updates[i].level = action.level;
+    }
+    // return action to free list
+    *link = action.next;
+    action.next = _free;
+    _free = index;
+    --_count;
+  }
+}
@@ -0,0 +1,203 @@
+/**
+ * @file    MCP23008-Scheduler.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Output Scheduler Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_SCHEDULER_H__
+
+#include "MCP23008-I2C.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief number of slots of the time wheel (power of two)
+   *
+   */
+  constexpr uint8_t MCP23008_SCHEDULER_SLOTS   {16};
+
+  /**
+   * @brief maximum number of pending actions of one scheduler
+   *
+   */
+  constexpr uint8_t MCP23008_SCHEDULER_ACTIONS {16};
+
+  /**
+   * @brief Class OutputScheduler
+   *
+   * Hashed time wheel for timed pin actions on one or more MCP23008 devices.
+   * An action (device, pin, level, due time) is queued in the slot of its
+   * due time. On each tick all actions which became due are collected and
+   * grouped per device, so every device touched by the tick gets exactly
+   * one update of its Output Latch register (OLAT), independent of the
+   * number of pin events.
+   *
+   * The time base is chosen by the caller (e.g. millis()), one slot covers
+   * one time unit. It starts with the first call of tick().
+   */
+  class OutputScheduler {
+    public:
+      /**
+       * @brief Construct a new OutputScheduler object
+       *
+       */
+      OutputScheduler();
+
+      /**
+       * @brief queue a pin action at an absolute due time
+       *
+       * Actions for the same pin which become due in the same tick are
+       * applied in order of their due time, the last one wins; actions
+       * with the same due time are applied in the order they were queued.
+       *
+       * @param device pointer to MCP23008 device
+       * @param pin pin number of pin 0...7
+       * @param level level to write 0/1
+       * @param due due time in units of the time base
+       * @return int8_t status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code
+       */
+      int8_t schedule(MCP23008 *device, uint8_t pin, uint8_t level, uint32_t due);
+
+      /**
+       * @brief queue a pin action relative to the time of the last tick
+       *
+       * The time base starts with the first tick(), so tick() must be
+       * called once before (e.g. in setup()).
+       *
+       * @param device pointer to MCP23008 device
+       * @param pin pin number of pin 0...7
+       * @param level level to write 0/1
+       * @param delay delay in units of the time base
+       * @return int8_t status
+       *
+       * @retval  0: state OK
+       * @retval <0: error code, MCP23008_ERROR_VALUE if tick() was not called yet
+       */
+      int8_t scheduleIn(MCP23008 *device, uint8_t pin, uint8_t level, uint32_t delay);
+
+      /**
+       * @brief remove all pending actions of a pin
+       *
+       * @param device pointer to MCP23008 device
+       * @param pin pin number of pin 0...7
+       * @return int number of removed actions
+       *
+       * @retval >=0: number of removed actions
+       * @retval  <0: error code
+       */
+      int cancel(MCP23008 *device, uint8_t pin);
+
+      /**
+       * @brief remove all pending actions
+       *
+       */
+      void clear();
+
+      /**
+       * @brief execute all actions which are due at time now
+       *
+       * Call this regularly with a monotonic time value (e.g. millis()).
+       * Actions of the same device are merged into one OLAT update.
+       * Due actions are consumed even if the I2C write fails.
+       *
+       * @param now current time in units of the time base
+       * @return int number of updated devices
+       *
+       * @retval >=0: number of updated devices
+       * @retval  <0: error code of the first failing device
+       */
+      int tick(uint32_t now);
+
+      /**
+       * @brief Get the number of pending actions
+       *
+       * @return uint8_t number of pending actions
+       */
+      uint8_t pending() const {return _count;}
+
+    private:
+      /**
+       * @brief marker for end of list
+       *
+       */
+      static constexpr uint8_t NONE {0xFF};
+
+      /**
+       * @brief queued pin action
+       *
+       */
+      struct Action {
+        MCP23008 *device;
+        uint32_t due;
+        uint8_t mask;
+        uint8_t level;
+        uint8_t next;
+      };
+
+      /**
+       * @brief latest due action of one pin during a tick
+       *
+       */
+      struct Update {
+        MCP23008 *device;
+        uint32_t due;
+        uint8_t mask;
+        uint8_t level;
+      };
+
+      /**
+       * @brief process due actions of one slot and merge them into updates per pin
+       *
+       * @param slot index of slot
+       * @param now current time
+       * @param updates list of merged updates
+       * @param count number of used entries in updates
+       */
+      void collect(uint8_t slot, uint32_t now, Update *updates, uint8_t &count);
+
+      /**
+       * @brief pool of actions
+       *
+       */
+      Action _actions[MCP23008_SCHEDULER_ACTIONS];
+
+      /**
+       * @brief head index of action list for each slot
+       *
+       */
+      uint8_t _slots[MCP23008_SCHEDULER_SLOTS];
+
+      /**
+       * @brief head index of free list
+       *
+       */
+      uint8_t _free;
+
+      /**
+       * @brief number of pending actions
+       *
+       */
+      uint8_t _count;
+
+      /**
+       * @brief time of last tick
+       *
+       */
+      uint32_t _lastTick;
+
+      /**
+       * @brief time base started by the first tick
+       *
+       */
+      bool _started;
+  };
+}
@@ -0,0 +1,128 @@
+/**
+ * @file    MCP23008-Trace.cpp
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Transaction Trace Recorder Definitions
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#include "MCP23008-Trace.h"
+
+using namespace MCP23008_I2C;
+
+TraceRecorder::TraceRecorder(uint8_t *buffer, uint16_t size)
+: _buffer{buffer}, _size{size}, _tail{0}, _length{0},
+  _tailAddress{0}, _headAddress{0}, _tailTime{0}, _headTime{0},
+  _dropped{0}, _enabled{(buffer != nullptr) && (size >= MIN_SIZE)}
+{}
+
+void TraceRecorder::clear() {
+  _tail = 0;
+  _length = 0;
+  _dropped = 0;
+}
+
+void TraceRecorder::record(uint8_t address, uint8_t regAddress, uint8_t flags, uint8_t value) {
+  if (!_enabled) {
+    return;
+  }
+  uint32_t now = micros();
+  if (_length == 0) {
+    _tailTime = now;
+    _headTime = now;
+    _tailAddress = address;
+    _headAddress = address;
+  }
+
+  // encode record: header, [address], varint delta, value
+  uint8_t record[8];
+  uint8_t n = 1;
+  record[0] = (regAddress & 0x0F) | (flags & (MCP23008_TRACE_READ | MCP23008_TRACE_ERROR | MCP23008_TRACE_BURST));
+  if (address != _headAddress) {
+    record[0] |= MCP23008_TRACE_ADDRESS;
+    record[n++] = address;
+  }
+  uint32_t delta = now - _headTime;
+  while (delta > 0x7F) {
+    record[n++] = (delta & 0x7F) | 0x80;
+    delta >>= 7;
+  }
+  record[n++] = delta;
+  record[n++] = value;
+
+  while ((_size - _length) < n) {
+    drop();
+  }
+  for (uint8_t i = 0; i < n; ++i) {
+    push(record[i]);
+  }
+  _headAddress = address;
+  _headTime = now;
+}
+
+size_t TraceRecorder::writeTo(Print &out) const {
+  const uint8_t header[] {
+    'M', 'T', MCP23008_TRACE_VERSION, _tailAddress,
+    static_cast<uint8_t>(_tailTime), static_cast<uint8_t>(_tailTime >> 8),
+    static_cast<uint8_t>(_tailTime >> 16), static_cast<uint8_t>(_tailTime >> 24),
+    static_cast<uint8_t>(_length), static_cast<uint8_t>(_length >> 8)
+  };
+  size_t n = out.write(header, sizeof(header));
+  // ring buffer may wrap, write both parts
+  uint16_t first = _size - _tail;
+  if (first >= _length) {
+    n += out.write(_buffer + _tail, _length);
+  }
+  else {
+    n += out.write(_buffer + _tail, first);
+    n += out.write(_buffer, _length - first);
+  }
+  return n;
+}
+
+void TraceRecorder::push(uint8_t value) {
+  // 32 bit index: tail + length may exceed 16 bit for buffers above 32 KiB
+  uint32_t head = static_cast<uint32_t>(_tail) + _length;
+  if (head >= _size) {
+    head -= _size;
+  }
+  _buffer[head] = value;
+  ++_length;
+}
+
+uint8_t TraceRecorder::peek(uint16_t offset) const {
+  uint32_t index = static_cast<uint32_t>(_tail) + offset;
+  if (index >= _size) {
+    index -= _size;
+  }
+  return _buffer[index];
+}
+
+void TraceRecorder::drop() {
+  uint8_t header = peek(0);
+  uint16_t n = 1;
+  if (header & MCP23008_TRACE_ADDRESS) {
+    _tailAddress = peek(n++);
+  }
+  uint32_t delta = 0;
+  uint8_t shift = 0;
+  uint8_t byte;
+  do {
+    byte = peek(n++);
+    delta |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  _tailTime += delta;
+  // skip value
+  ++n;
+
+  uint32_t tail = static_cast<uint32_t>(_tail) + n;
+  if (tail >= _size) {
+    tail -= _size;
+  }
+  _tail = tail;
+  _length -= n;
+  ++_dropped;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file    MCP23008-Trace.h
+ * @author  Frank Häfele
+ * @date    18.10.2026
+ * @version 1.1.0
+ * @brief   MCP23008 Transaction Trace Recorder Declarations
+ * @see     https://github.com/hasenradball/MCP23008-I2C
+ *
+ */
+
+#pragma once
+
+#define __MCP23008_TRACE_H__
+
+#include "Arduino.h"
+
+namespace MCP23008_I2C {
+
+  /**
+   * @brief version of the binary trace format
+   *
+   */
+  constexpr uint8_t MCP23008_TRACE_VERSION     {1};
+
+  /**
+   * @brief record flag: register was read (cleared = written)
+   *
+   */
+  constexpr uint8_t MCP23008_TRACE_READ        {0x10};
+
+  /**
+   * @brief record flag: I2C communication failed
+   *
+   */
+  constexpr uint8_t MCP23008_TRACE_ERROR       {0x20};
+
+  /**
+   * @brief record flag: device address byte follows (address changed)
+   *
+   */
+  constexpr uint8_t MCP23008_TRACE_ADDRESS     {0x40};
+
+  /**
+   * @brief record flag: byte continues the sequential transfer of the previous record
+   *
+   */
+  constexpr uint8_t MCP23008_TRACE_BURST       {0x80};
+
+  /**
+   * @brief Class TraceRecorder
+   *
+   * Records register accesses into a fixed RAM ring buffer. When the
+   * buffer is full, the oldest records are dropped.
+   *
+   * Record format:
+   *
+   * byte 0: bits 0-3 register, bit 4 read, bit 5 error, bit 6 address follows, bit 7 burst
+   *
+   * [address]: 7-bit device address, only when it differs from the previous record
+   *
+   * delta: time since previous record in microseconds as varint (7 bits per byte, LSB first)
+   *
+   * value: register value
+   *
+   * The dump written by writeTo() starts with a header:
+   * 'M', 'T', version, address of first record, start time (uint32, little endian),
+   * number of record bytes (uint16, little endian)
+   */
+  class TraceRecorder {
+    public:
+      /**
+       * @brief Construct a new TraceRecorder object
+       *
+       * @param buffer buffer for records
+       * @param size size of buffer in bytes (at least 8)
+       */
+      TraceRecorder(uint8_t *buffer, uint16_t size);
+
+      /**
+       * @brief record one register access
+       *
+       * @param address address of I2C device
+       * @param regAddress address of register
+       * @param flags combination of MCP23008_TRACE_READ, MCP23008_TRACE_ERROR and MCP23008_TRACE_BURST
+       * @param value register value
+       */
+      void record(uint8_t address, uint8_t regAddress, uint8_t flags, uint8_t value);
+
+      /**
+       * @brief enable or disable recording, only enabled with a valid buffer
+       *
+       * @param enabled true or false
+       */
+      void enable(bool enabled) {_enabled = enabled && (_buffer != nullptr) && (_size >= MIN_SIZE);}
+
+      /**
+       * @brief remove all records
+       *
+       */
+      void clear();
+
+      /**
+       * @brief write header and records to an output stream
+       *
+       * @param out output stream e.g. Serial
+       * @return size_t number of bytes written
+       */
+      size_t writeTo(Print &out) const;
+
+      /**
+       * @brief Get the number of record bytes in the buffer
+       *
+       * @return uint16_t number of bytes
+       */
+      uint16_t length() const {return _length;}
+
+      /**
+       * @brief Get the number of records dropped because the buffer was full
+       *
+       * @return uint32_t number of dropped records
+       */
+      uint32_t dropped() const {return _dropped;}
+
+    private:
+      /**
+       * @brief minimum size of buffer in bytes, the longest record
+       *
+       */
+      static constexpr uint16_t MIN_SIZE {8};
+
+      /**
+       * @brief append byte at head of ring buffer
+       *
+       * @param value byte to append
+       */
+      void push(uint8_t value);
+
+      /**
+       * @brief get byte at offset from tail of ring buffer
+       *
+       * @param offset offset from tail
+       * @return uint8_t byte
+       */
+      uint8_t peek(uint16_t offset) const;
+
+      /**
+       * @brief remove the oldest record
+       *
+       */
+      void drop();
+
+      /**
+       * @brief buffer for records
+       *
+       */
+      uint8_t *_buffer;
+
+      /**
+       * @brief size of buffer
+       *
+       */
+      uint16_t _size;
+
+      /**
+       * @brief index of oldest byte
+       *
+       */
+      uint16_t _tail;
+
+      /**
+       * @brief number of used bytes
+       *
+       */
+      uint16_t _length;
+
+      /**
+       * @brief device address of the oldest record
+       *
+       */
+      uint8_t _tailAddress;
+
+      /**
+       * @brief device address of the newest record
+       *
+       */
+      uint8_t _headAddress;
+
+      /**
+       * @brief time reference of the oldest record
+       *
+       */
+      uint32_t _tailTime;
+
+      /**
+       * @brief time of the newest record
+       *
+       */
+      uint32_t _headTime;
+
+      /**
+       * @brief number of dropped records
+       *
+       */
+      uint32_t _dropped;
+
+      /**
+       * @brief recording state
+       *
+       */
+      bool _enabled;
+  };
+}